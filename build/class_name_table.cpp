@@ -0,0 +1,50 @@
+#include "class_name_table.h"
+
+namespace class_name_table{
+extern const Segment_with_value<uint8_t, Categories_set> categories_table[] = {
+    {{U']', U']'},  0x8},  {{U'A', U'Z'},  0x2},  {{U'a', U'z'},  0x2},  
+    {{U':', U':'},  0x4}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x4, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x1, 0x1, 0x8, 0x1, 0x1, 
+    0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x5F, 0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0x7,  0xAF, 0xAF, 0x8F, 0xAF, 0xAF, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x50, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'9'},     {U';', U'@'},  {U'[', U'\\'},  {U'^', U'`'},  
+    {U'{', 1114111},  {U'A', U'Z'},  {U'a', U'z'},   {U':', U':'},  
+    {U']', U']'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,  5,  7,  8,  9
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114058,  52,  1,  1
+};
+
+} // namespace class_name_table
+
@@ -0,0 +1,390 @@
+#ifndef CLASS_NAME_TABLE_H
+#define CLASS_NAME_TABLE_H
+#include "search_templates.h"
+
+namespace class_name_table{
+enum Category : uint16_t {
+    Other,             Letter,  Colon,
+    Closed_square_br
+};
+
+using Categories_set = uint8_t;
+
+extern const Segment_with_value<uint8_t, Categories_set> categories_table[];
+
+static const size_t num_of_elems_in_categories_table = 4;
+
+static const char32_t max_char_in_categories_table = U'z';
+static const Categories_set default_categories_set = 0x1;
+
+inline Categories_set get_categories_set(char32_t c){
+    if(c > max_char_in_categories_table){
+        return default_categories_set;
+    }
+    auto t = knuth_find(categories_table,
+                        categories_table + num_of_elems_in_categories_table,
+                        static_cast<uint8_t>(c));
+
+    return t.first ? categories_table[t.second].value : default_categories_set;
+}
+
+inline bool belongs(Category cat, Categories_set s){
+    return (s >> cat) & 1;
+}
+
+inline bool intersects(Categories_set a, Categories_set b){
+    return (a & b) != 0;
+}
+
+static const char32_t num_of_direct_chars = 128;
+
+extern const Categories_set direct_categories_table[];
+
+static const size_t num_of_ascii_categories = 4;
+
+extern const uint8_t direct_category_nibbles[];
+
+inline Categories_set get_categories_set_direct(char32_t c){
+    return (c < num_of_direct_chars) ? direct_categories_table[c] : get_categories_set(c);
+}
+
+/*
+ * Helpers of the span functions. They are inline rather than static, since the span
+ * functions, which have external linkage, must refer to the same entities in all
+ * translation units.
+*/
+namespace detail{
+#ifdef __SSSE3__
+/*
+ * Bitmap of the ASCII characters that have a category from mask: the bit h of the byte l
+ * is set for the character 16 * h + l.
+*/
+inline __m128i ascii_bitmap(const Categories_set& mask){
+    __m128i result = _mm_setzero_si128();
+    for(uint64_t m = mask; m; m &= m - 1){
+        size_t k = __builtin_ctzll(m);
+        if(k < num_of_ascii_categories){
+            const uint8_t* row = direct_category_nibbles + 16 * k;
+            result = _mm_or_si128(result, _mm_loadu_si128(reinterpret_cast<const __m128i*>(row)));
+        }
+    }
+    return result;
+}
+
+/* Bits of the bytes of block that are ASCII characters present in bitmap. */
+inline unsigned ascii_matches(__m128i block, __m128i bitmap){
+    const __m128i bit_of_high = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i low_nibble  = _mm_set1_epi8(0x0F);
+    __m128i       row         = _mm_shuffle_epi8(bitmap, _mm_and_si128(block, low_nibble));
+    __m128i       bit         = _mm_shuffle_epi8(bit_of_high,
+                                                 _mm_and_si128(_mm_srli_epi16(block, 4), low_nibble));
+    __m128i       absent      = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+    return ~static_cast<unsigned>(_mm_movemask_epi8(absent)) & 0xFFFF;
+}
+#endif
+
+/*
+ * Decodes one character and moves p past it. Invalid sequences, i.e. overlong forms,
+ * surrogates and values above U+10FFFF, are decoded as U+FFFD one byte at a time.
+*/
+inline char32_t decode_utf8_char(const char*& p, const char* end){
+    static const char32_t min_char_of_len[] = {0, 0, 0x80, 0x800, 0x10000};
+    unsigned char b = static_cast<unsigned char>(*p);
+    size_t        len;
+    char32_t      c;
+    if(b < 0x80){
+        p++;
+        return b;
+    }else if((b >= 0xC2) && (b <= 0xDF)){
+        len = 2; c = b & 0x1F;
+    }else if((b & 0xF0) == 0xE0){
+        len = 3; c = b & 0x0F;
+    }else if((b >= 0xF0) && (b <= 0xF4)){
+        len = 4; c = b & 0x07;
+    }else{
+        p++;
+        return 0xFFFD;
+    }
+    if(static_cast<size_t>(end - p) < len){
+        p++;
+        return 0xFFFD;
+    }
+    for(size_t i = 1; i < len; i++){
+        unsigned char cont = static_cast<unsigned char>(p[i]);
+        if((cont & 0xC0) != 0x80){
+            p++;
+            return 0xFFFD;
+        }
+        c = (c << 6) | (cont & 0x3F);
+    }
+    if((c < min_char_of_len[len]) || ((c >= 0xD800) && (c <= 0xDFFF)) || (c > 0x10FFFF)){
+        p++;
+        return 0xFFFD;
+    }
+    p += len;
+    return c;
+}
+
+/*
+ * Returns the first character from [p, end) for which the presence of categories from
+ * mask differs from expected. While all characters of a block are less than
+ * num_of_direct_chars, blocks of 16 characters are tested by SSSE3 (if it is enabled),
+ * and blocks of four characters are looked up in the direct-indexed table.
+*/
+inline const char32_t* span(const char32_t* p, const char32_t* end,
+                            const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap    = ascii_bitmap(mask);
+    const __m128i  not_ascii = _mm_set1_epi32(~0x7F);
+    const unsigned inverse   = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            const __m128i* v   = reinterpret_cast<const __m128i*>(p);
+            __m128i        a   = _mm_loadu_si128(v);
+            __m128i        b   = _mm_loadu_si128(v + 1);
+            __m128i        c   = _mm_loadu_si128(v + 2);
+            __m128i        d   = _mm_loadu_si128(v + 3);
+            __m128i        any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, not_ascii),
+                                                 _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            __m128i  block = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            unsigned stops = ascii_matches(block, bitmap) ^ inverse;
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 16;
+        }
+#endif
+        while((end - p >= 4) && ((p[0] | p[1] | p[2] | p[3]) < num_of_direct_chars)){
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 4; i++){
+                stops |= unsigned(intersects(direct_categories_table[p[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 4;
+        }
+        if(p == end){
+            return p;
+        }
+        if(intersects(get_categories_set_direct(*p), mask) != expected){
+            return p;
+        }
+        p++;
+    }
+}
+
+/*
+ * The same for UTF-8: blocks of 16 bytes (with SSSE3) and of eight bytes are processed
+ * while all of them are ASCII. The ASCII bytes before the first non-ASCII byte of a block
+ * of 16 bytes are processed by SSSE3 too.
+*/
+inline const char* span_utf8(const char* p, const char* end,
+                             const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap  = ascii_bitmap(mask);
+    const unsigned inverse = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            __m128i  block     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned non_ascii = static_cast<unsigned>(_mm_movemask_epi8(block));
+            unsigned stops     = ascii_matches(block, bitmap) ^ inverse;
+            if(non_ascii){
+                stops &= (1u << __builtin_ctz(non_ascii)) - 1;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            if(non_ascii){
+                p += __builtin_ctz(non_ascii);
+                break;
+            }
+            p += 16;
+        }
+#endif
+        while(end - p >= 8){
+            const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+            if((u[0] | u[1] | u[2] | u[3] | u[4] | u[5] | u[6] | u[7]) & 0x80){
+                break;
+            }
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 8; i++){
+                stops |= unsigned(intersects(direct_categories_table[u[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 8;
+        }
+        if(p == end){
+            return p;
+        }
+        const char* q = p;
+        char32_t    c = decode_utf8_char(q, end);
+        if(intersects(get_categories_set_direct(c), mask) != expected){
+            return p;
+        }
+        p = q;
+    }
+}
+} // namespace detail
+
+/* End of the run of characters having at least one category from mask. */
+inline const char32_t* span_while(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, true);
+}
+
+/* End of the run of characters having no categories from mask. */
+inline const char32_t* span_until(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, false);
+}
+
+inline const char* span_while_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, true);
+}
+
+inline const char* span_until_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, false);
+}
+
+/*
+ * Classification of characters with the hint: the element of the table found last time.
+ * Since a text usually contains long runs of characters of the same script, the next
+ * character is often in the same element or in the neighbouring one. The numbers of
+ * lookups and of hits are counted for characters not greater than
+ * max_char_in_categories_table; greater characters are classified without the table.
+*/
+class Classifier{
+public:
+    Categories_set get_categories_set(char32_t c);
+
+    size_t num_of_lookups() const {return lookups;}
+    size_t num_of_hits()    const {return hits;}
+    double hit_rate()       const {return lookups ? static_cast<double>(hits) / lookups : 0.0;}
+private:
+    size_t hint    = 0;
+    size_t lookups = 0;
+    size_t hits    = 0;
+
+    /* Members rather than static functions, since get_categories_set has external linkage. */
+    static size_t highest_bit(size_t x);
+    static size_t next_node(size_t i);
+    static size_t prev_node(size_t i);
+};
+
+/*
+ * Neighbours of the node i in the order of characters. Nodes are numbered from 1, as in
+ * knuth_find: the children of the node i are the nodes 2i and 2i + 1. Zero means that
+ * there is no neighbour.
+*/
+inline size_t Classifier::highest_bit(size_t x){
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(x);
+}
+
+inline size_t Classifier::next_node(size_t i){
+    size_t n = num_of_elems_in_categories_table;
+    if(2 * i + 1 <= n){
+        /* The leftmost node of the right subtree. */
+        size_t j = (2 * i + 1) << (highest_bit(n) - highest_bit(2 * i + 1));
+        return (j > n) ? (j >> 1) : j;
+    }
+    /* The parent of the nearest ancestor that is a left child. */
+    return i >> (__builtin_ctzll(~static_cast<unsigned long long>(i)) + 1);
+}
+
+inline size_t Classifier::prev_node(size_t i){
+    size_t n = num_of_elems_in_categories_table;
+    if(2 * i <= n){
+        /* The rightmost node of the left subtree. */
+        size_t j = ((2 * i + 1) << (highest_bit(n) - highest_bit(2 * i))) - 1;
+        return (j > n) ? (j >> 1) : j;
+    }
+    /* The parent of the nearest ancestor that is a right child. */
+    return i >> (__builtin_ctzll(i) + 1);
+}
+
+inline Categories_set Classifier::get_categories_set(char32_t c){
+    if(c > max_char_in_categories_table){
+        return default_categories_set;
+    }
+    uint8_t key = static_cast<uint8_t>(c);
+    lookups++;
+    if(hint){
+        const auto& curr = categories_table[hint - 1];
+        if(key < curr.bounds.lower_bound){
+            size_t prev = prev_node(hint);
+            if(!prev || (key > categories_table[prev - 1].bounds.upper_bound)){
+                hits++;
+                return default_categories_set;
+            }
+            if(key >= categories_table[prev - 1].bounds.lower_bound){
+                hits++;
+                hint = prev;
+                return categories_table[prev - 1].value;
+            }
+        }else if(key > curr.bounds.upper_bound){
+            size_t next = next_node(hint);
+            if(!next || (key < categories_table[next - 1].bounds.lower_bound)){
+                hits++;
+                return default_categories_set;
+            }
+            if(key <= categories_table[next - 1].bounds.upper_bound){
+                hits++;
+                hint = next;
+                return categories_table[next - 1].value;
+            }
+        }else{
+            hits++;
+            return curr.value;
+        }
+    }
+    auto t = knuth_find(categories_table,
+                        categories_table + num_of_elems_in_categories_table,
+                        key);
+    if(t.first){
+        hint = t.second + 1;
+        return categories_table[t.second].value;
+    }
+    return default_categories_set;
+}
+
+/*
+ * Inverse index: the ranges of the category k are the elements of category_ranges with
+ * indices from category_ranges_offsets[k] up to category_ranges_offsets[k + 1] - 1.
+*/
+extern const Segment<char32_t> category_ranges[];
+
+extern const size_t category_ranges_offsets[];
+
+extern const size_t num_of_chars_in_category[];
+
+struct Category_ranges{
+    const Segment<char32_t>* first;
+    const Segment<char32_t>* last;
+
+    const Segment<char32_t>* begin() const {return first;}
+    const Segment<char32_t>* end()   const {return last;}
+    size_t                   size()  const {return last - first;}
+};
+
+/* Sorted disjoint ranges of characters having the category cat. */
+inline Category_ranges ranges_of_category(Category cat){
+    return Category_ranges{category_ranges + category_ranges_offsets[cat],
+                           category_ranges + category_ranges_offsets[cat + 1]};
+}
+} // namespace class_name_table
+#endif
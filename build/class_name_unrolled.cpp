@@ -0,0 +1,81 @@
+#include "class_name_unrolled.h"
+
+namespace class_name_unrolled{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'['){
+        if(c < U';'){
+            if(c < U':'){
+                return default_categories_set;
+            }else{
+                return 0x4;
+            }
+        }else{
+            if(c < U'A'){
+                return default_categories_set;
+            }else{
+                return 0x2;
+            }
+        }
+    }else{
+        if(c < U'^'){
+            if(c < U']'){
+                return default_categories_set;
+            }else{
+                return 0x8;
+            }
+        }else{
+            if(c < U'a'){
+                return default_categories_set;
+            }else{
+                if(c < U'{'){
+                    return 0x2;
+                }else{
+                    return default_categories_set;
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x1, 0x4, 0x1, 0x1, 0x1, 0x1, 0x1, 
+    0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x1, 0x1, 0x8, 0x1, 0x1, 
+    0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x5F, 0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0x7,  0xAF, 0xAF, 0x8F, 0xAF, 0xAF, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x50, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'9'},     {U';', U'@'},  {U'[', U'\\'},  {U'^', U'`'},  
+    {U'{', 1114111},  {U'A', U'Z'},  {U'a', U'z'},   {U':', U':'},  
+    {U']', U']'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,  5,  7,  8,  9
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114058,  52,  1,  1
+};
+
+} // namespace class_name_unrolled
+
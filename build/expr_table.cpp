@@ -0,0 +1,78 @@
+#include "expr_table.h"
+
+namespace expr_table{
+extern const Segment_with_value<uint8_t, Categories_set> categories_table[] = {
+    {{U'b', U'b'}, 0x10C},   {{U'R', U'R'}, 0x10C},  {{U'p', U'q'},  0xC},     
+    {{U'?', U'?'}, 0x210},   {{U']', U']'}, 0x200},  {{U'l', U'l'}, 0x10C},    
+    {{U'y', U'z'},  0xC},    {{U'(', U'+'}, 0x210},  {{U'L', U'L'}, 0x10C},    
+    {{U'[', U'['}, 0x280},   {{U'_', U'_'},  0xC},   {{U'd', U'd'}, 0x10C},    
+    {{U'n', U'n'}, 0x30C},   {{U's', U'w'},  0xC},   {{U'|', U'|'}, 0x210},    
+    {{U'"', U'"'}, 0x200},   {{U'0', U'9'},  0x8},   {{U'A', U'K'},  0xC},     
+    {{U'M', U'Q'},  0xC},    {{U'S', U'Z'},  0xC},   {{U'\\', U'\\'}, 0x240},  
+    {{U'^', U'^'}, 0x1200},  {{U'a', U'a'},  0xC},   {{U'c', U'c'},  0xC},     
+    {{U'e', U'k'},  0xC},    {{U'm', U'm'},  0xC},   {{U'o', U'o'}, 0x10C},    
+    {{U'r', U'r'}, 0x10C},   {{U'x', U'x'}, 0x10C},  {{U'{', U'{'}, 0x610},    
+    {{U'}', U'}'}, 0xA10},   {{   1,   32},  0x1},   {{U'$', U'$'}, 0x220}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x2,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x2,   0x200, 0x2,   0x220, 0x2,   0x2,    0x2,   
+    0x210, 0x210, 0x210, 0x210, 0x2,   0x2,   0x2,    0x2,   
+    0x8,   0x8,   0x8,   0x8,   0x8,   0x8,   0x8,    0x8,   
+    0x8,   0x8,   0x2,   0x2,   0x2,   0x2,   0x2,    0x210, 
+    0x2,   0xC,   0xC,   0xC,   0xC,   0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0xC,   0x10C, 0xC,   0xC,    0xC,   
+    0xC,   0xC,   0x10C, 0xC,   0xC,   0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0x280, 0x240, 0x200, 0x1200, 0xC,   
+    0x2,   0xC,   0x10C, 0xC,   0x10C, 0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0xC,   0x10C, 0xC,   0x30C,  0x10C, 
+    0xC,   0xC,   0x10C, 0xC,   0xC,   0xC,   0xC,    0xC,   
+    0x10C, 0xC,   0xC,   0x610, 0x210, 0xA10, 0x2,    0x2
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x6,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  
+    0x51, 0x4,  0x0,  0x4,  0x0,  0x4,  0x4,  0x4,  0x0,  0x0,  0x8,  0x8,  0xC,  0xC,  0x8C, 0x84, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0xA8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0x84, 0x80, 0x80, 0x0,  0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0xE0, 0x0,  0x40, 0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x50, 0x0,  0x40, 0x40, 
+    0x0,  0x0,  0x4,  0x0,  0x4,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0xA4, 0xA0, 0xA0, 0x60, 0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   1,   32},   {   0,    0},     {U'!', U'!'},  {U'#', U'#'},  
+    {U'%', U'\''},  {U',', U'/'},     {U':', U'>'},  {U'@', U'@'},  
+    {U'`', U'`'},   {U'~', 1114111},  {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'0', U'9'},     {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'(', U'+'},     {U'?', U'?'},  {U'{', U'}'},  
+    {U'$', U'$'},   {U'\\', U'\\'},   {U'[', U'['},  {U'L', U'L'},  
+    {U'R', U'R'},   {U'b', U'b'},     {U'd', U'd'},  {U'l', U'l'},  
+    {U'n', U'o'},   {U'r', U'r'},     {U'x', U'x'},  {U'"', U'"'},  
+    {U'$', U'$'},   {U'(', U'+'},     {U'?', U'?'},  {U'[', U'^'},  
+    {U'n', U'n'},   {U'{', U'}'},     {U'{', U'{'},  {U'}', U'}'},  
+    {U'^', U'^'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   1,   10,  13,  17,  20,  21,  22,  
+    23,  31,  38,  39,  40,  41
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    32,  1114003,  53,  63,  8,  1,  1,  1,  
+    9,   15,       1,   1,   1
+};
+
+} // namespace expr_table
+
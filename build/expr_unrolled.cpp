@@ -0,0 +1,232 @@
+#include "expr_unrolled.h"
+
+namespace expr_unrolled{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'^'){
+        if(c < U':'){
+            if(c < U'$'){
+                if(c < U'!'){
+                    if(c <    1){
+                        return default_categories_set;
+                    }else{
+                        return 0x1;
+                    }
+                }else{
+                    if(c < U'"'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'#'){
+                            return 0x200;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'('){
+                    if(c < U'%'){
+                        return 0x220;
+                    }else{
+                        return default_categories_set;
+                    }
+                }else{
+                    if(c < U','){
+                        return 0x210;
+                    }else{
+                        if(c < U'0'){
+                            return default_categories_set;
+                        }else{
+                            return 0x8;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'M'){
+                if(c < U'@'){
+                    if(c < U'?'){
+                        return default_categories_set;
+                    }else{
+                        return 0x210;
+                    }
+                }else{
+                    if(c < U'A'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'L'){
+                            return 0xC;
+                        }else{
+                            return 0x10C;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'['){
+                    if(c < U'R'){
+                        return 0xC;
+                    }else{
+                        if(c < U'S'){
+                            return 0x10C;
+                        }else{
+                            return 0xC;
+                        }
+                    }
+                }else{
+                    if(c < U'\\'){
+                        return 0x280;
+                    }else{
+                        if(c < U']'){
+                            return 0x240;
+                        }else{
+                            return 0x200;
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'n'){
+            if(c < U'c'){
+                if(c < U'`'){
+                    if(c < U'_'){
+                        return 0x1200;
+                    }else{
+                        return 0xC;
+                    }
+                }else{
+                    if(c < U'a'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'b'){
+                            return 0xC;
+                        }else{
+                            return 0x10C;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'e'){
+                    if(c < U'd'){
+                        return 0xC;
+                    }else{
+                        return 0x10C;
+                    }
+                }else{
+                    if(c < U'l'){
+                        return 0xC;
+                    }else{
+                        if(c < U'm'){
+                            return 0x10C;
+                        }else{
+                            return 0xC;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'x'){
+                if(c < U'p'){
+                    if(c < U'o'){
+                        return 0x30C;
+                    }else{
+                        return 0x10C;
+                    }
+                }else{
+                    if(c < U'r'){
+                        return 0xC;
+                    }else{
+                        if(c < U's'){
+                            return 0x10C;
+                        }else{
+                            return 0xC;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'|'){
+                    if(c < U'y'){
+                        return 0x10C;
+                    }else{
+                        if(c < U'{'){
+                            return 0xC;
+                        }else{
+                            return 0x610;
+                        }
+                    }
+                }else{
+                    if(c < U'}'){
+                        return 0x210;
+                    }else{
+                        if(c < U'~'){
+                            return 0xA10;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x2,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x1,   0x1,   0x1,   0x1,   0x1,   0x1,    0x1,   
+    0x1,   0x2,   0x200, 0x2,   0x220, 0x2,   0x2,    0x2,   
+    0x210, 0x210, 0x210, 0x210, 0x2,   0x2,   0x2,    0x2,   
+    0x8,   0x8,   0x8,   0x8,   0x8,   0x8,   0x8,    0x8,   
+    0x8,   0x8,   0x2,   0x2,   0x2,   0x2,   0x2,    0x210, 
+    0x2,   0xC,   0xC,   0xC,   0xC,   0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0xC,   0x10C, 0xC,   0xC,    0xC,   
+    0xC,   0xC,   0x10C, 0xC,   0xC,   0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0x280, 0x240, 0x200, 0x1200, 0xC,   
+    0x2,   0xC,   0x10C, 0xC,   0x10C, 0xC,   0xC,    0xC,   
+    0xC,   0xC,   0xC,   0xC,   0x10C, 0xC,   0x30C,  0x10C, 
+    0xC,   0xC,   0x10C, 0xC,   0xC,   0xC,   0xC,    0xC,   
+    0x10C, 0xC,   0xC,   0x610, 0x210, 0xA10, 0x2,    0x2
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x6,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  
+    0x51, 0x4,  0x0,  0x4,  0x0,  0x4,  0x4,  0x4,  0x0,  0x0,  0x8,  0x8,  0xC,  0xC,  0x8C, 0x84, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0xA8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0x84, 0x80, 0x80, 0x0,  0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0xE0, 0x0,  0x40, 0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x50, 0x0,  0x40, 0x40, 
+    0x0,  0x0,  0x4,  0x0,  0x4,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0xA4, 0xA0, 0xA0, 0x60, 0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   1,   32},   {   0,    0},     {U'!', U'!'},  {U'#', U'#'},  
+    {U'%', U'\''},  {U',', U'/'},     {U':', U'>'},  {U'@', U'@'},  
+    {U'`', U'`'},   {U'~', 1114111},  {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'0', U'9'},     {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'(', U'+'},     {U'?', U'?'},  {U'{', U'}'},  
+    {U'$', U'$'},   {U'\\', U'\\'},   {U'[', U'['},  {U'L', U'L'},  
+    {U'R', U'R'},   {U'b', U'b'},     {U'd', U'd'},  {U'l', U'l'},  
+    {U'n', U'o'},   {U'r', U'r'},     {U'x', U'x'},  {U'"', U'"'},  
+    {U'$', U'$'},   {U'(', U'+'},     {U'?', U'?'},  {U'[', U'^'},  
+    {U'n', U'n'},   {U'{', U'}'},     {U'{', U'{'},  {U'}', U'}'},  
+    {U'^', U'^'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   1,   10,  13,  17,  20,  21,  22,  
+    23,  31,  38,  39,  40,  41
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    32,  1114003,  53,  63,  8,  1,  1,  1,  
+    9,   15,       1,   1,   1
+};
+
+} // namespace expr_unrolled
+
@@ -0,0 +1,278 @@
+#ifndef EXPR_UNROLLED_H
+#define EXPR_UNROLLED_H
+#include "search_templates.h"
+
+namespace expr_unrolled{
+enum Category : uint16_t {
+    Spaces,            Other,             Action_name_begin,
+    Action_name_body,  Delimiters,        Dollar,
+    Backslash,         Opened_square_br,  After_colon,
+    After_backslash,   Begin_expr,        End_expr,
+    Hat
+};
+
+using Categories_set = uint16_t;
+
+static const Categories_set default_categories_set = 0x2;
+
+Categories_set get_categories_set(char32_t c);
+
+inline bool belongs(Category cat, Categories_set s){
+    return (s >> cat) & 1;
+}
+
+inline bool intersects(Categories_set a, Categories_set b){
+    return (a & b) != 0;
+}
+
+static const char32_t num_of_direct_chars = 128;
+
+extern const Categories_set direct_categories_table[];
+
+static const size_t num_of_ascii_categories = 13;
+
+extern const uint8_t direct_category_nibbles[];
+
+inline Categories_set get_categories_set_direct(char32_t c){
+    return (c < num_of_direct_chars) ? direct_categories_table[c] : get_categories_set(c);
+}
+
+/*
+ * Helpers of the span functions. They are inline rather than static, since the span
+ * functions, which have external linkage, must refer to the same entities in all
+ * translation units.
+*/
+namespace detail{
+#ifdef __SSSE3__
+/*
+ * Bitmap of the ASCII characters that have a category from mask: the bit h of the byte l
+ * is set for the character 16 * h + l.
+*/
+inline __m128i ascii_bitmap(const Categories_set& mask){
+    __m128i result = _mm_setzero_si128();
+    for(uint64_t m = mask; m; m &= m - 1){
+        size_t k = __builtin_ctzll(m);
+        if(k < num_of_ascii_categories){
+            const uint8_t* row = direct_category_nibbles + 16 * k;
+            result = _mm_or_si128(result, _mm_loadu_si128(reinterpret_cast<const __m128i*>(row)));
+        }
+    }
+    return result;
+}
+
+/* Bits of the bytes of block that are ASCII characters present in bitmap. */
+inline unsigned ascii_matches(__m128i block, __m128i bitmap){
+    const __m128i bit_of_high = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i low_nibble  = _mm_set1_epi8(0x0F);
+    __m128i       row         = _mm_shuffle_epi8(bitmap, _mm_and_si128(block, low_nibble));
+    __m128i       bit         = _mm_shuffle_epi8(bit_of_high,
+                                                 _mm_and_si128(_mm_srli_epi16(block, 4), low_nibble));
+    __m128i       absent      = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+    return ~static_cast<unsigned>(_mm_movemask_epi8(absent)) & 0xFFFF;
+}
+#endif
+
+/*
+ * Decodes one character and moves p past it. Invalid sequences, i.e. overlong forms,
+ * surrogates and values above U+10FFFF, are decoded as U+FFFD one byte at a time.
+*/
+inline char32_t decode_utf8_char(const char*& p, const char* end){
+    static const char32_t min_char_of_len[] = {0, 0, 0x80, 0x800, 0x10000};
+    unsigned char b = static_cast<unsigned char>(*p);
+    size_t        len;
+    char32_t      c;
+    if(b < 0x80){
+        p++;
+        return b;
+    }else if((b >= 0xC2) && (b <= 0xDF)){
+        len = 2; c = b & 0x1F;
+    }else if((b & 0xF0) == 0xE0){
+        len = 3; c = b & 0x0F;
+    }else if((b >= 0xF0) && (b <= 0xF4)){
+        len = 4; c = b & 0x07;
+    }else{
+        p++;
+        return 0xFFFD;
+    }
+    if(static_cast<size_t>(end - p) < len){
+        p++;
+        return 0xFFFD;
+    }
+    for(size_t i = 1; i < len; i++){
+        unsigned char cont = static_cast<unsigned char>(p[i]);
+        if((cont & 0xC0) != 0x80){
+            p++;
+            return 0xFFFD;
+        }
+        c = (c << 6) | (cont & 0x3F);
+    }
+    if((c < min_char_of_len[len]) || ((c >= 0xD800) && (c <= 0xDFFF)) || (c > 0x10FFFF)){
+        p++;
+        return 0xFFFD;
+    }
+    p += len;
+    return c;
+}
+
+/*
+ * Returns the first character from [p, end) for which the presence of categories from
+ * mask differs from expected. While all characters of a block are less than
+ * num_of_direct_chars, blocks of 16 characters are tested by SSSE3 (if it is enabled),
+ * and blocks of four characters are looked up in the direct-indexed table.
+*/
+inline const char32_t* span(const char32_t* p, const char32_t* end,
+                            const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap    = ascii_bitmap(mask);
+    const __m128i  not_ascii = _mm_set1_epi32(~0x7F);
+    const unsigned inverse   = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            const __m128i* v   = reinterpret_cast<const __m128i*>(p);
+            __m128i        a   = _mm_loadu_si128(v);
+            __m128i        b   = _mm_loadu_si128(v + 1);
+            __m128i        c   = _mm_loadu_si128(v + 2);
+            __m128i        d   = _mm_loadu_si128(v + 3);
+            __m128i        any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, not_ascii),
+                                                 _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            __m128i  block = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            unsigned stops = ascii_matches(block, bitmap) ^ inverse;
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 16;
+        }
+#endif
+        while((end - p >= 4) && ((p[0] | p[1] | p[2] | p[3]) < num_of_direct_chars)){
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 4; i++){
+                stops |= unsigned(intersects(direct_categories_table[p[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 4;
+        }
+        if(p == end){
+            return p;
+        }
+        if(intersects(get_categories_set_direct(*p), mask) != expected){
+            return p;
+        }
+        p++;
+    }
+}
+
+/*
+ * The same for UTF-8: blocks of 16 bytes (with SSSE3) and of eight bytes are processed
+ * while all of them are ASCII. The ASCII bytes before the first non-ASCII byte of a block
+ * of 16 bytes are processed by SSSE3 too.
+*/
+inline const char* span_utf8(const char* p, const char* end,
+                             const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap  = ascii_bitmap(mask);
+    const unsigned inverse = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            __m128i  block     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned non_ascii = static_cast<unsigned>(_mm_movemask_epi8(block));
+            unsigned stops     = ascii_matches(block, bitmap) ^ inverse;
+            if(non_ascii){
+                stops &= (1u << __builtin_ctz(non_ascii)) - 1;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            if(non_ascii){
+                p += __builtin_ctz(non_ascii);
+                break;
+            }
+            p += 16;
+        }
+#endif
+        while(end - p >= 8){
+            const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+            if((u[0] | u[1] | u[2] | u[3] | u[4] | u[5] | u[6] | u[7]) & 0x80){
+                break;
+            }
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 8; i++){
+                stops |= unsigned(intersects(direct_categories_table[u[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 8;
+        }
+        if(p == end){
+            return p;
+        }
+        const char* q = p;
+        char32_t    c = decode_utf8_char(q, end);
+        if(intersects(get_categories_set_direct(c), mask) != expected){
+            return p;
+        }
+        p = q;
+    }
+}
+} // namespace detail
+
+/* End of the run of characters having at least one category from mask. */
+inline const char32_t* span_while(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, true);
+}
+
+/* End of the run of characters having no categories from mask. */
+inline const char32_t* span_until(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, false);
+}
+
+inline const char* span_while_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, true);
+}
+
+inline const char* span_until_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, false);
+}
+
+/*
+ * Inverse index: the ranges of the category k are the elements of category_ranges with
+ * indices from category_ranges_offsets[k] up to category_ranges_offsets[k + 1] - 1.
+*/
+extern const Segment<char32_t> category_ranges[];
+
+extern const size_t category_ranges_offsets[];
+
+extern const size_t num_of_chars_in_category[];
+
+struct Category_ranges{
+    const Segment<char32_t>* first;
+    const Segment<char32_t>* last;
+
+    const Segment<char32_t>* begin() const {return first;}
+    const Segment<char32_t>* end()   const {return last;}
+    size_t                   size()  const {return last - first;}
+};
+
+/* Sorted disjoint ranges of characters having the category cat. */
+inline Category_ranges ranges_of_category(Category cat){
+    return Category_ranges{category_ranges + category_ranges_offsets[cat],
+                           category_ranges + category_ranges_offsets[cat + 1]};
+}
+} // namespace expr_unrolled
+#endif
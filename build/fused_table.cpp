@@ -0,0 +1,103 @@
+#include "fused_table.h"
+
+namespace fused_table{
+extern const Segment_with_value<uint8_t, Categories_set> categories_table[] = {
+    {{U'b', U'b'}, 0x410CU},  {{U'R', U'R'}, 0x410CU},   {{U'p', U'q'}, 0x400CU},    
+    {{U'?', U'?'}, 0x2210U},  {{U']', U']'}, 0x10200U},  {{U'l', U'l'}, 0x410CU},    
+    {{U'y', U'z'}, 0x400CU},  {{U'(', U'+'}, 0x2210U},   {{U'L', U'L'}, 0x410CU},    
+    {{U'[', U'['}, 0x2280U},  {{U'_', U'_'}, 0x200CU},   {{U'd', U'd'}, 0x410CU},    
+    {{U'n', U'n'}, 0x430CU},  {{U's', U'w'}, 0x400CU},   {{U'|', U'|'}, 0x2210U},    
+    {{U'"', U'"'}, 0x2200U},  {{U':', U':'}, 0x8002U},   {{U'A', U'K'}, 0x400CU},    
+    {{U'M', U'Q'}, 0x400CU},  {{U'S', U'Z'}, 0x400CU},   {{U'\\', U'\\'}, 0x2240U},  
+    {{U'^', U'^'}, 0x3200U},  {{U'a', U'a'}, 0x400CU},   {{U'c', U'c'}, 0x400CU},    
+    {{U'e', U'k'}, 0x400CU},  {{U'm', U'm'}, 0x400CU},   {{U'o', U'o'}, 0x410CU},    
+    {{U'r', U'r'}, 0x410CU},  {{U'x', U'x'}, 0x410CU},   {{U'{', U'{'}, 0x2610U},    
+    {{U'}', U'}'}, 0x2A10U},  {{   1,   32}, 0x2001U},   {{U'$', U'$'}, 0x2220U},    
+    {{U'0', U'9'}, 0x2008U}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x2002U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2002U, 0x2200U, 0x2002U, 0x2220U, 0x2002U,  0x2002U, 0x2002U, 
+    0x2210U, 0x2210U, 0x2210U, 0x2210U, 0x2002U, 0x2002U,  0x2002U, 0x2002U, 
+    0x2008U, 0x2008U, 0x2008U, 0x2008U, 0x2008U, 0x2008U,  0x2008U, 0x2008U, 
+    0x2008U, 0x2008U, 0x8002U, 0x2002U, 0x2002U, 0x2002U,  0x2002U, 0x2210U, 
+    0x2002U, 0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x410CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x410CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x2280U, 0x2240U, 0x10200U, 0x3200U, 0x200CU, 
+    0x2002U, 0x400CU, 0x410CU, 0x400CU, 0x410CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x410CU, 0x400CU,  0x430CU, 0x410CU, 
+    0x400CU, 0x400CU, 0x410CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x410CU, 0x400CU, 0x400CU, 0x2610U, 0x2210U, 0x2A10U,  0x2002U, 0x2002U
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x6,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  
+    0x51, 0x4,  0x0,  0x4,  0x0,  0x4,  0x4,  0x4,  0x0,  0x0,  0x8,  0x8,  0xC,  0xC,  0x8C, 0x84, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0xA8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0x84, 0x80, 0x80, 0x0,  0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0xE0, 0x0,  0x40, 0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x50, 0x0,  0x40, 0x40, 
+    0x0,  0x0,  0x4,  0x0,  0x4,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0xA4, 0xA0, 0xA0, 0x60, 0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  
+    0x5F, 0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0x7,  0xAF, 0xAF, 0x8F, 0xAF, 0xAF, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x50, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0
+};
+
+namespace expr{
+extern const Segment<char32_t> category_ranges[] = {
+    {   1,   32},   {   0,    0},     {U'!', U'!'},  {U'#', U'#'},  
+    {U'%', U'\''},  {U',', U'/'},     {U':', U'>'},  {U'@', U'@'},  
+    {U'`', U'`'},   {U'~', 1114111},  {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'0', U'9'},     {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'(', U'+'},     {U'?', U'?'},  {U'{', U'}'},  
+    {U'$', U'$'},   {U'\\', U'\\'},   {U'[', U'['},  {U'L', U'L'},  
+    {U'R', U'R'},   {U'b', U'b'},     {U'd', U'd'},  {U'l', U'l'},  
+    {U'n', U'o'},   {U'r', U'r'},     {U'x', U'x'},  {U'"', U'"'},  
+    {U'$', U'$'},   {U'(', U'+'},     {U'?', U'?'},  {U'[', U'^'},  
+    {U'n', U'n'},   {U'{', U'}'},     {U'{', U'{'},  {U'}', U'}'},  
+    {U'^', U'^'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   1,   10,  13,  17,  20,  21,  22,  
+    23,  31,  38,  39,  40,  41
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    32,  1114003,  53,  63,  8,  1,  1,  1,  
+    9,   15,       1,   1,   1
+};
+
+} // namespace expr
+
+namespace class_name{
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'9'},     {U';', U'@'},  {U'[', U'\\'},  {U'^', U'`'},  
+    {U'{', 1114111},  {U'A', U'Z'},  {U'a', U'z'},   {U':', U':'},  
+    {U']', U']'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,  5,  7,  8,  9
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114058,  52,  1,  1
+};
+
+} // namespace class_name
+
+} // namespace fused_table
+
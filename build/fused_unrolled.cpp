@@ -0,0 +1,260 @@
+#include "fused_unrolled.h"
+
+namespace fused_unrolled{
+Categories_set get_categories_set(char32_t c){
+    if(c < U']'){
+        if(c < U':'){
+            if(c < U'$'){
+                if(c < U'!'){
+                    if(c <    1){
+                        return default_categories_set;
+                    }else{
+                        return 0x2001U;
+                    }
+                }else{
+                    if(c < U'"'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'#'){
+                            return 0x2200U;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'('){
+                    if(c < U'%'){
+                        return 0x2220U;
+                    }else{
+                        return default_categories_set;
+                    }
+                }else{
+                    if(c < U','){
+                        return 0x2210U;
+                    }else{
+                        if(c < U'0'){
+                            return default_categories_set;
+                        }else{
+                            return 0x2008U;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'L'){
+                if(c < U'?'){
+                    if(c < U';'){
+                        return 0x8002U;
+                    }else{
+                        return default_categories_set;
+                    }
+                }else{
+                    if(c < U'@'){
+                        return 0x2210U;
+                    }else{
+                        if(c < U'A'){
+                            return default_categories_set;
+                        }else{
+                            return 0x400CU;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'S'){
+                    if(c < U'M'){
+                        return 0x410CU;
+                    }else{
+                        if(c < U'R'){
+                            return 0x400CU;
+                        }else{
+                            return 0x410CU;
+                        }
+                    }
+                }else{
+                    if(c < U'['){
+                        return 0x400CU;
+                    }else{
+                        if(c < U'\\'){
+                            return 0x2280U;
+                        }else{
+                            return 0x2240U;
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'n'){
+            if(c < U'b'){
+                if(c < U'_'){
+                    if(c < U'^'){
+                        return 0x10200U;
+                    }else{
+                        return 0x3200U;
+                    }
+                }else{
+                    if(c < U'`'){
+                        return 0x200CU;
+                    }else{
+                        if(c < U'a'){
+                            return default_categories_set;
+                        }else{
+                            return 0x400CU;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'e'){
+                    if(c < U'c'){
+                        return 0x410CU;
+                    }else{
+                        if(c < U'd'){
+                            return 0x400CU;
+                        }else{
+                            return 0x410CU;
+                        }
+                    }
+                }else{
+                    if(c < U'l'){
+                        return 0x400CU;
+                    }else{
+                        if(c < U'm'){
+                            return 0x410CU;
+                        }else{
+                            return 0x400CU;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'x'){
+                if(c < U'p'){
+                    if(c < U'o'){
+                        return 0x430CU;
+                    }else{
+                        return 0x410CU;
+                    }
+                }else{
+                    if(c < U'r'){
+                        return 0x400CU;
+                    }else{
+                        if(c < U's'){
+                            return 0x410CU;
+                        }else{
+                            return 0x400CU;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'|'){
+                    if(c < U'y'){
+                        return 0x410CU;
+                    }else{
+                        if(c < U'{'){
+                            return 0x400CU;
+                        }else{
+                            return 0x2610U;
+                        }
+                    }
+                }else{
+                    if(c < U'}'){
+                        return 0x2210U;
+                    }else{
+                        if(c < U'~'){
+                            return 0x2A10U;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x2002U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U, 0x2001U,  0x2001U, 0x2001U, 
+    0x2001U, 0x2002U, 0x2200U, 0x2002U, 0x2220U, 0x2002U,  0x2002U, 0x2002U, 
+    0x2210U, 0x2210U, 0x2210U, 0x2210U, 0x2002U, 0x2002U,  0x2002U, 0x2002U, 
+    0x2008U, 0x2008U, 0x2008U, 0x2008U, 0x2008U, 0x2008U,  0x2008U, 0x2008U, 
+    0x2008U, 0x2008U, 0x8002U, 0x2002U, 0x2002U, 0x2002U,  0x2002U, 0x2210U, 
+    0x2002U, 0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x410CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x410CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x2280U, 0x2240U, 0x10200U, 0x3200U, 0x200CU, 
+    0x2002U, 0x400CU, 0x410CU, 0x400CU, 0x410CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x400CU, 0x400CU, 0x400CU, 0x400CU, 0x410CU, 0x400CU,  0x430CU, 0x410CU, 
+    0x400CU, 0x400CU, 0x410CU, 0x400CU, 0x400CU, 0x400CU,  0x400CU, 0x400CU, 
+    0x410CU, 0x400CU, 0x400CU, 0x2610U, 0x2210U, 0x2A10U,  0x2002U, 0x2002U
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x6,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  0x3,  
+    0x51, 0x4,  0x0,  0x4,  0x0,  0x4,  0x4,  0x4,  0x0,  0x0,  0x8,  0x8,  0xC,  0xC,  0x8C, 0x84, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0xA8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x70, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0x84, 0x80, 0x80, 0x0,  0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x4,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0xE0, 0x0,  0x40, 0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x50, 0x0,  0x40, 0x40, 
+    0x0,  0x0,  0x4,  0x0,  0x4,  0x0,  0x0,  0x0,  0x4,  0x4,  0x4,  0xA4, 0xA0, 0xA0, 0x60, 0x8,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x80, 0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  
+    0x5F, 0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0xF,  0x7,  0xAF, 0xAF, 0x8F, 0xAF, 0xAF, 
+    0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0x50, 0x50, 0x50, 0x50, 
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x8,  0x0,  0x0,  0x0,  0x0,  0x0,  
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x20, 0x0,  0x0
+};
+
+namespace expr{
+extern const Segment<char32_t> category_ranges[] = {
+    {   1,   32},   {   0,    0},     {U'!', U'!'},  {U'#', U'#'},  
+    {U'%', U'\''},  {U',', U'/'},     {U':', U'>'},  {U'@', U'@'},  
+    {U'`', U'`'},   {U'~', 1114111},  {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'0', U'9'},     {U'A', U'Z'},  {U'_', U'_'},  
+    {U'a', U'z'},   {U'(', U'+'},     {U'?', U'?'},  {U'{', U'}'},  
+    {U'$', U'$'},   {U'\\', U'\\'},   {U'[', U'['},  {U'L', U'L'},  
+    {U'R', U'R'},   {U'b', U'b'},     {U'd', U'd'},  {U'l', U'l'},  
+    {U'n', U'o'},   {U'r', U'r'},     {U'x', U'x'},  {U'"', U'"'},  
+    {U'$', U'$'},   {U'(', U'+'},     {U'?', U'?'},  {U'[', U'^'},  
+    {U'n', U'n'},   {U'{', U'}'},     {U'{', U'{'},  {U'}', U'}'},  
+    {U'^', U'^'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   1,   10,  13,  17,  20,  21,  22,  
+    23,  31,  38,  39,  40,  41
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    32,  1114003,  53,  63,  8,  1,  1,  1,  
+    9,   15,       1,   1,   1
+};
+
+} // namespace expr
+
+namespace class_name{
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'9'},     {U';', U'@'},  {U'[', U'\\'},  {U'^', U'`'},  
+    {U'{', 1114111},  {U'A', U'Z'},  {U'a', U'z'},   {U':', U':'},  
+    {U']', U']'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,  5,  7,  8,  9
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114058,  52,  1,  1
+};
+
+} // namespace class_name
+
+} // namespace fused_unrolled
+
@@ -0,0 +1,209 @@
+#include "synthetic_table_128.h"
+
+namespace synthetic_table_128{
+extern const Segment_with_value<uint16_t, Categories_set> categories_table[] = {
+    {{U'ư', U'ƴ'}, 0x4D},  {{U'á', U'è'}, 0xB1},  {{U'ɤ', U'ɪ'}, 0x6A},  
+    {{ 129,  129}, 0xE3},    {{U'Ş', U'Ş'}, 0x1E},  {{U'Ȓ', U'ȓ'}, 0x4E},  
+    {{U'ʽ', U'˄'}, 0x44},  {{U'U', U'X'}, 0xCC},    {{U'­', U'´'}, 0xCA},  
+    {{U'Ĥ', U'ī'}, 0x97},  {{U'ƀ', U'Ƃ'}, 0x10},  {{U'Ǣ', U'Ǩ'}, 0x80},  
+    {{U'Ȼ', U'ȿ'}, 0x68},  {{U'ʔ', U'ʗ'}, 0x42},  {{U'˳', U'˳'}, 0x14},  
+    {{U'<', U'<'}, 0x6C},    {{U'k', U'm'}, 0xBB},    {{ 151,  153}, 0xA5},    
+    {{U'Í', U'Í'}, 0x2A},  {{U'ą', U'Č'}, 0x48},  {{U'Ń', U'ń'}, 0x91},  
+    {{U'Ů', U'ų'}, 0x79},  {{U'ƚ', U'ƞ'}, 0xEE},  {{U'Ǌ', U'Ǎ'}, 0xCE},  
+    {{U'ǽ', U'ȁ'}, 0xEE},  {{U'Ȩ', U'ȩ'}, 0xDC},  {{U'ɑ', U'ɑ'}, 0x1E},  
+    {{U'ɿ', U'ʃ'}, 0x76},  {{U'ʬ', U'ʭ'}, 0xE7},  {{U'˜', U'ˠ'}, 0x26},  
+    {{U'̀', U'̆'}, 0x29},  {{U'2', U'6'}, 0xC6},    {{U'G', U'M'}, 0xC0},    
+    {{U'_', U'_'}, 0x71},    {{U'r', U'x'}, 0x76},    {{ 139,  142}, 0x39},    
+    {{ 158, U'¡'}, 0x88},   {{U'½', U'Ä'}, 0x37},  {{U'Õ', U'Û'},  0xA},  
+    {{U'õ', U'ü'}, 0x1E},  {{U'Ė', U'ě'}, 0xC6},  {{U'Ķ', U'ļ'}, 0x77},  
+    {{U'ŉ', U'ŏ'}, 0x33},  {{U'ŧ', U'Ũ'}, 0xB6},  {{U'ŷ', U'Ÿ'}, 0xD3},  
+    {{U'ƌ', U'Ɠ'}, 0x75},  {{U'Ƨ', U'Ƨ'}, 0x99},  {{U'ƽ', U'Ǆ'}, 0xE7},  
+    {{U'ǒ', U'ǖ'}, 0x24},  {{U'Ǳ', U'Ǵ'}, 0xF2},  {{U'ȋ', U'ȍ'},  0xF},  
+    {{U'ȝ', U'Ȟ'}, 0x11},  {{U'Ȳ', U'Ȳ'}, 0xF6},  {{U'Ʉ', U'Ʌ'}, 0xFA},  
+    {{U'ə', U'ə'}, 0xA0},  {{U'ɱ', U'ɷ'}, 0x23},  {{U'ʋ', U'ʏ'}, 0x4D},  
+    {{U'ʠ', U'ʣ'}, 0x57},  {{U'ʲ', U'ʶ'}, 0x50},  {{U'ˎ', U'˔'}, 0x3C},  
+    {{U'˦', U'˩'}, 0xA5},  {{U'˷', U'˹'},  0x8},  {{U'̌', U'̍'}, 0xE6},  
+    {{U'(', U'/'}, 0x95},    {{U'8', U';'}, 0x5A},    {{U'@', U'E'}, 0x6D},    
+    {{U'N', U'R'}, 0xD9},    {{U'Z', U'\\'}, 0xB9},   {{U'c', U'j'}, 0x84},    
+    {{U'n', U'n'}, 0xDA},    {{U'y', U'}'}, 0x22},    {{ 131,  138}, 0xB3},    
+    {{ 144,  148}, 0xE7},    {{ 154,  155}, 0x77},    {{U'¥', U'¬'}, 0x95},  
+    {{U'·', U'¼'}, 0xAD},  {{U'Ç', U'Ë'}, 0xF5},  {{U'Ñ', U'Ó'}, 0x81},  
+    {{U'Ý', U'à'}, 0x1A},  {{U'ì', U'ñ'}, 0x9F},  {{U'ÿ', U'Ą'}, 0x53},  
+    {{U'č', U'Ĕ'}, 0x50},  {{U'ĝ', U'Ģ'}, 0xCC},  {{U'Ĭ', U'Ĳ'}, 0x79},  
+    {{U'Ľ', U'ł'}, 0x85},  {{U'Ņ', U'Ň'}, 0xD6},  {{U'œ', U'Ś'}, 0xEF},  
+    {{U'š', U'Ť'}, 0xDB},  {{U'Ŭ', U'ŭ'}, 0xFD},  {{U'Ŵ', U'ŵ'}, 0x98},  
+    {{U'ż', U'Ž'}, 0xE1},  {{U'Ƅ', U'Ɗ'}, 0x78},  {{U'Ɩ', U'Ƙ'}, 0xD8},  
+    {{U'Ƣ', U'Ƥ'}, 0x7A},  {{U'ƫ', U'ƭ'},  0x4},  {{U'Ʒ', U'ƹ'}, 0xF2},  
+    {{U'Ǉ', U'ǉ'}, 0xEF},  {{U'ǎ', U'ǐ'}, 0x95},  {{U'ǚ', U'Ǟ'}, 0xC0},  
+    {{U'Ǭ', U'ǯ'},  0x9},  {{U'Ƿ', U'ǹ'}, 0xE5},  {{U'Ȃ', U'Ȉ'}, 0x2B},  
+    {{U'ȑ', U'ȑ'}, 0xF1},  {{U'Ȗ', U'ș'}, 0x57},  {{U'ȡ', U'ȧ'}, 0xD9},  
+    {{U'ȭ', U'ȯ'}, 0xFD},  {{U'ȵ', U'ȹ'}, 0x9B},  {{U'Ƀ', U'Ƀ'}, 0x83},  
+    {{U'Ɉ', U'ɍ'}, 0x11},  {{U'ɔ', U'ɖ'}, 0x58},  {{U'ɜ', U'ɣ'}, 0x55},  
+    {{U'ɮ', U'ɯ'}, 0xDB},  {{U'ɺ', U'ɻ'}, 0x24},  {{U'ʅ', U'ʊ'},  0x7},  
+    {{U'ʑ', U'ʑ'}, 0xB6},  {{U'ʚ', U'ʞ'}, 0x39},  {{U'ʤ', U'ʩ'}, 0xEF},  
+    {{U'ʰ', U'ʱ'}, 0x96},  {{U'ʷ', U'ʺ'}, 0x2F},  {{U'˅', U'ˋ'}, 0x53},  
+    {{U'˖', U'˙'}, 0x5D},  {{U'ˣ', U'˥'}, 0x17},  {{U'˪', U'˯'}, 0x27},  
+    {{U'˶', U'˶'}, 0x67},  {{U'˻', U'˼'}, 0xAB},  {{U'̊', U'̊'}, 0x7A},  
+    {{U'̑', U'̗'}, 0xF8},  {{U'"', U'%'}, 0xFC}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0xFC, 0xFC, 0xFC, 0xFC, 0x1,  0x1,  
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
+    0x1,  0x1,  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x1,  
+    0x5A, 0x5A, 0x5A, 0x5A, 0x6C, 0x1,  0x1,  0x1,  
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x1,  0xC0, 
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xD9, 0xD9, 
+    0xD9, 0xD9, 0xD9, 0x1,  0x1,  0xCC, 0xCC, 0xCC, 
+    0xCC, 0x1,  0xB9, 0xB9, 0xB9, 0x1,  0x1,  0x71, 
+    0x1,  0x1,  0x1,  0x84, 0x84, 0x84, 0x84, 0x84, 
+    0x84, 0x84, 0x84, 0xBB, 0xBB, 0xBB, 0xDA, 0x1,  
+    0x1,  0x1,  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x76, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1,  0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0xFF, 0xFF, 0x73, 0x33, 0x33, 0x13, 0x17, 0xF,  0x7,  0x27, 0x27, 0x67, 0x67, 0x6F, 0xBF, 0xFF, 
+    0x0,  0x0,  0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x88, 0x88, 0x88, 0xC8, 0xC0, 0xC0, 0x40, 0x0,  
+    0x10, 0x10, 0x9C, 0xDC, 0xDC, 0xFC, 0xE8, 0xE0, 0xE4, 0x44, 0x44, 0x4,  0xC,  0x4,  0x4,  0x4,  
+    0x30, 0x30, 0x34, 0x14, 0x14, 0x34, 0x20, 0x20, 0x28, 0x8,  0x28, 0x68, 0x68, 0x40, 0x50, 0x10, 
+    0x20, 0x20, 0xA4, 0x84, 0x84, 0x84, 0x80, 0x80, 0x8C, 0xC,  0x2C, 0x6C, 0x64, 0x44, 0x54, 0x34, 
+    0x10, 0x10, 0x94, 0x94, 0x94, 0x94, 0x80, 0x80, 0x80, 0x80, 0xA0, 0xE0, 0xE8, 0xC0, 0x0,  0x20, 
+    0x30, 0x30, 0xBC, 0x9C, 0x9C, 0xBC, 0xA8, 0xB0, 0xB8, 0x18, 0x18, 0x18, 0x18, 0x10, 0x50, 0x30, 
+    0x20, 0x20, 0x2C, 0x4C, 0x4C, 0x6C, 0x68, 0x70, 0x74, 0x54, 0x74, 0x74, 0x74, 0x54, 0x54, 0x14
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'!'},      {U'&', U'1'},    {U'7', U'7'},    {U'=', U'F'},    
+    {U'N', U'T'},      {U'Y', U'b'},    {U'k', U'm'},    {U'o', U'q'},    
+    {U'~',  157},      {U'¢', U'¬'},  {U'µ', U'Ì'},  {U'Î', U'Ô'},  
+    {U'Ü', U'Ü'},    {U'á', U'ô'},  {U'ý', U'Ą'},  {U'ĕ', U'ĕ'},  
+    {U'Ĝ', U'Ĝ'},    {U'ģ', U'ń'},  {U'ň', U'ŝ'},  {U'ş', U'Ŧ'},  
+    {U'ũ', U'ų'},    {U'Ŷ', U'ſ'},  {U'ƃ', U'ƃ'},  {U'Ƌ', U'ƕ'},  
+    {U'ƙ', U'ƙ'},    {U'Ɵ', U'ơ'},  {U'ƥ', U'ƪ'},  {U'Ʈ', U'ƶ'},  
+    {U'ƺ', U'ǉ'},    {U'ǎ', U'Ǒ'},  {U'Ǘ', U'Ǚ'},  {U'ǟ', U'ǡ'},  
+    {U'ǩ', U'ǰ'},    {U'ǵ', U'Ǽ'},  {U'Ȃ', U'ȑ'},  {U'Ȕ', U'ȧ'},  
+    {U'Ȫ', U'ȱ'},    {U'ȳ', U'Ⱥ'},  {U'ɀ', U'Ƀ'},  {U'Ɇ', U'ɐ'},  
+    {U'ɒ', U'ɓ'},    {U'ɗ', U'ɘ'},  {U'ɚ', U'ɣ'},  {U'ɫ', U'ɹ'},  
+    {U'ɼ', U'ɾ'},    {U'ʄ', U'ʐ'},  {U'ʒ', U'ʓ'},  {U'ʘ', U'ʯ'},  
+    {U'ʷ', U'ʼ'},    {U'˅', U'ˍ'},  {U'˕', U'˛'},  {U'ˡ', U'˲'},  
+    {U'˴', U'˶'},    {U'˺', U'̉'},  {U'̋', U'̋'},  {U'̎', U'̐'},  
+    {U'̘', 1114111},  {U'2', U'6'},    {U'8', U';'},    {U'k', U'n'},    
+    {U'r', U'}'},      { 129,  129},    { 131,  138},    { 144,  148},    
+    { 154,  155},      {U'­', U'´'},  {U'½', U'Ä'},  {U'Í', U'Í'},  
+    {U'Õ', U'Û'},    {U'Ý', U'à'},  {U'ì', U'ñ'},  {U'õ', U'ü'},  
+    {U'ÿ', U'Ą'},    {U'Ė', U'ě'},  {U'Ĥ', U'ī'},  {U'Ķ', U'ļ'},  
+    {U'Ņ', U'Ň'},    {U'ŉ', U'ŏ'},  {U'œ', U'Ś'},  {U'Ş', U'Ş'},  
+    {U'š', U'Ť'},    {U'ŧ', U'Ũ'},  {U'ŷ', U'Ÿ'},  {U'ƚ', U'ƞ'},  
+    {U'Ƣ', U'Ƥ'},    {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  {U'Ǉ', U'Ǎ'},  
+    {U'Ǳ', U'Ǵ'},    {U'ǽ', U'Ȉ'},  {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  
+    {U'Ȗ', U'ș'},    {U'Ȳ', U'Ȳ'},  {U'ȵ', U'ȹ'},  {U'Ƀ', U'Ʌ'},  
+    {U'ɑ', U'ɑ'},    {U'ɤ', U'ɪ'},  {U'ɮ', U'ɯ'},  {U'ɱ', U'ɷ'},  
+    {U'ɿ', U'ʃ'},    {U'ʅ', U'ʊ'},  {U'ʑ', U'ʑ'},  {U'ʔ', U'ʗ'},  
+    {U'ʠ', U'ʩ'},    {U'ʬ', U'ʭ'},  {U'ʰ', U'ʱ'},  {U'ʷ', U'ʺ'},  
+    {U'˅', U'ˋ'},    {U'˜', U'ˠ'},  {U'ˣ', U'˥'},  {U'˪', U'˯'},  
+    {U'˶', U'˶'},    {U'˻', U'˼'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'"', U'%'},      {U'(', U'/'},    {U'2', U'6'},    {U'<', U'<'},    
+    {U'@', U'E'},      {U'U', U'X'},    {U'c', U'j'},    {U'r', U'x'},    
+    { 144,  148},      { 151,  155},    {U'¥', U'¬'},  {U'·', U'Ä'},  
+    {U'Ç', U'Ë'},    {U'ì', U'ñ'},  {U'õ', U'ü'},  {U'Ė', U'ě'},  
+    {U'ĝ', U'Ģ'},    {U'Ĥ', U'ī'},  {U'Ķ', U'ł'},  {U'Ņ', U'Ň'},  
+    {U'œ', U'Ś'},    {U'Ş', U'Ş'},  {U'ŧ', U'Ũ'},  {U'Ŭ', U'ŭ'},  
+    {U'ƌ', U'Ɠ'},    {U'ƚ', U'ƞ'},  {U'ƫ', U'ƭ'},  {U'ư', U'ƴ'},  
+    {U'ƽ', U'Ǆ'},    {U'Ǉ', U'ǐ'},  {U'ǒ', U'ǖ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'ȁ'},    {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  {U'Ȗ', U'ș'},  
+    {U'Ȩ', U'ȩ'},    {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  {U'ɑ', U'ɑ'},  
+    {U'ɜ', U'ɣ'},    {U'ɺ', U'ɻ'},  {U'ɿ', U'ʃ'},  {U'ʅ', U'ʏ'},  
+    {U'ʑ', U'ʑ'},    {U'ʠ', U'ʩ'},  {U'ʬ', U'ʭ'},  {U'ʰ', U'ʱ'},  
+    {U'ʷ', U'ʺ'},    {U'ʽ', U'˄'},  {U'ˎ', U'˔'},  {U'˖', U'˙'},  
+    {U'˜', U'ˠ'},    {U'ˣ', U'˯'},  {U'˳', U'˳'},  {U'˶', U'˶'},  
+    {U'̌', U'̍'},    {U'"', U'%'},    {U'8', U'<'},    {U'@', U'E'},    
+    {U'N', U'R'},      {U'U', U'X'},    {U'Z', U'\\'},   {U'k', U'n'},    
+    { 139,  142},      { 158, U'¡'},   {U'­', U'´'},  {U'·', U'¼'},  
+    {U'Í', U'Í'},    {U'Õ', U'Û'},  {U'Ý', U'à'},  {U'ì', U'ñ'},  
+    {U'õ', U'ü'},    {U'ą', U'Č'},  {U'ĝ', U'Ģ'},  {U'Ĭ', U'Ĳ'},  
+    {U'œ', U'Ś'},    {U'Ş', U'Ş'},  {U'š', U'Ť'},  {U'Ŭ', U'ŵ'},  
+    {U'Ƅ', U'Ɗ'},    {U'Ɩ', U'Ƙ'},  {U'ƚ', U'ƞ'},  {U'Ƣ', U'Ƥ'},  
+    {U'Ƨ', U'Ƨ'},    {U'ư', U'ƴ'},  {U'Ǉ', U'Ǎ'},  {U'Ǭ', U'ǯ'},  
+    {U'ǽ', U'Ȉ'},    {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  {U'ȡ', U'ȩ'},  
+    {U'ȭ', U'ȯ'},    {U'ȵ', U'ȹ'},  {U'Ȼ', U'ȿ'},  {U'Ʉ', U'Ʌ'},  
+    {U'ɑ', U'ɑ'},    {U'ɔ', U'ɖ'},  {U'ɤ', U'ɪ'},  {U'ɮ', U'ɯ'},  
+    {U'ʋ', U'ʏ'},    {U'ʚ', U'ʞ'},  {U'ʤ', U'ʩ'},  {U'ʷ', U'ʺ'},  
+    {U'ˎ', U'˔'},    {U'˖', U'˙'},  {U'˷', U'˹'},  {U'˻', U'˼'},  
+    {U'̀', U'̆'},    {U'̊', U'̊'},  {U'̑', U'̗'},  {U'"', U'%'},    
+    {U'(', U'/'},      {U'8', U';'},    {U'N', U'R'},    {U'Z', U'\\'},   
+    {U'_', U'_'},      {U'k', U'n'},    {U'r', U'x'},    { 131,  142},    
+    { 154,  155},      {U'¥', U'¬'},  {U'½', U'Ä'},  {U'Ç', U'Ë'},  
+    {U'Ý', U'è'},    {U'ì', U'ñ'},  {U'õ', U'ü'},  {U'ÿ', U'Ą'},  
+    {U'č', U'Ĕ'},    {U'Ĥ', U'Ĳ'},  {U'Ķ', U'ļ'},  {U'Ń', U'Ň'},  
+    {U'ŉ', U'ŏ'},    {U'Ş', U'Ş'},  {U'š', U'Ť'},  {U'ŧ', U'Ũ'},  
+    {U'Ŭ', U'ŵ'},    {U'ŷ', U'Ÿ'},  {U'ƀ', U'Ƃ'},  {U'Ƅ', U'Ɗ'},  
+    {U'ƌ', U'Ɠ'},    {U'Ɩ', U'Ƙ'},  {U'Ƣ', U'Ƥ'},  {U'Ƨ', U'Ƨ'},  
+    {U'Ʒ', U'ƹ'},    {U'ǎ', U'ǐ'},  {U'Ǳ', U'Ǵ'},  {U'ȑ', U'ȑ'},  
+    {U'Ȗ', U'ș'},    {U'ȝ', U'Ȟ'},  {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  
+    {U'Ȳ', U'Ȳ'},    {U'ȵ', U'ȹ'},  {U'Ʉ', U'Ʌ'},  {U'Ɉ', U'ɍ'},  
+    {U'ɑ', U'ɑ'},    {U'ɔ', U'ɖ'},  {U'ɜ', U'ɣ'},  {U'ɮ', U'ɯ'},  
+    {U'ɿ', U'ʃ'},    {U'ʑ', U'ʑ'},  {U'ʚ', U'ʞ'},  {U'ʠ', U'ʣ'},  
+    {U'ʰ', U'ʶ'},    {U'˅', U'ˋ'},  {U'ˎ', U'˔'},  {U'˖', U'˙'},  
+    {U'ˣ', U'˥'},    {U'˳', U'˳'},  {U'̊', U'̊'},  {U'̑', U'̗'},  
+    {U'"', U'%'},      {U'<', U'<'},    {U'@', U'E'},    {U'Z', U'\\'},   
+    {U'_', U'_'},      {U'k', U'm'},    {U'r', U'}'},    { 129,  129},    
+    { 131,  142},      { 144,  148},    { 151,  155},    {U'·', U'Ä'},  
+    {U'Ç', U'Ë'},    {U'Í', U'Í'},  {U'á', U'è'},  {U'Ĭ', U'Ĳ'},  
+    {U'Ķ', U'ļ'},    {U'ŉ', U'ŏ'},  {U'œ', U'Ś'},  {U'ŧ', U'Ũ'},  
+    {U'Ŭ', U'ų'},    {U'ż', U'Ž'},  {U'Ƅ', U'Ɗ'},  {U'ƌ', U'Ɠ'},  
+    {U'ƚ', U'ƞ'},    {U'Ƣ', U'Ƥ'},  {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  
+    {U'Ǉ', U'ǉ'},    {U'ǒ', U'ǖ'},  {U'Ǳ', U'Ǵ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'Ȉ'},    {U'ȑ', U'ȑ'},  {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  
+    {U'Ȼ', U'ȿ'},    {U'Ʉ', U'Ʌ'},  {U'ə', U'ə'},  {U'ɤ', U'ɪ'},  
+    {U'ɱ', U'ɷ'},    {U'ɺ', U'ɻ'},  {U'ɿ', U'ʃ'},  {U'ʑ', U'ʑ'},  
+    {U'ʚ', U'ʞ'},    {U'ʤ', U'ʩ'},  {U'ʬ', U'ʭ'},  {U'ʷ', U'ʺ'},  
+    {U'ˎ', U'˔'},    {U'˜', U'ˠ'},  {U'˦', U'˯'},  {U'˶', U'˶'},  
+    {U'˻', U'˼'},    {U'̀', U'̆'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'},    {U'"', U'%'},    {U'2', U'6'},    {U'8', U'<'},    
+    {U'@', U'E'},      {U'G', U'R'},    {U'U', U'X'},    {U'_', U'_'},    
+    {U'n', U'n'},      {U'r', U'x'},    { 129,  129},    { 144,  148},    
+    { 154,  155},      {U'­', U'´'},  {U'Ç', U'Ë'},  {U'ÿ', U'Ĕ'},  
+    {U'Ė', U'ě'},    {U'ĝ', U'Ģ'},  {U'Ĭ', U'Ĳ'},  {U'Ķ', U'ļ'},  
+    {U'Ņ', U'Ň'},    {U'œ', U'Ś'},  {U'š', U'Ť'},  {U'Ŭ', U'ų'},  
+    {U'ŷ', U'Ÿ'},    {U'ż', U'Ž'},  {U'Ƅ', U'Ɗ'},  {U'ƌ', U'Ɠ'},  
+    {U'Ɩ', U'Ƙ'},    {U'ƚ', U'ƞ'},  {U'Ƣ', U'Ƥ'},  {U'ư', U'ƴ'},  
+    {U'Ʒ', U'ƹ'},    {U'ƽ', U'Ǆ'},  {U'Ǉ', U'Ǎ'},  {U'ǚ', U'Ǟ'},  
+    {U'Ǳ', U'Ǵ'},    {U'Ƿ', U'ǹ'},  {U'ǽ', U'ȁ'},  {U'ȑ', U'ȓ'},  
+    {U'Ȗ', U'ș'},    {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  
+    {U'Ȼ', U'ȿ'},    {U'Ʉ', U'Ʌ'},  {U'ɔ', U'ɖ'},  {U'ɜ', U'ɪ'},  
+    {U'ɮ', U'ɯ'},    {U'ɿ', U'ʃ'},  {U'ʋ', U'ʏ'},  {U'ʔ', U'ʗ'},  
+    {U'ʠ', U'ʩ'},    {U'ʬ', U'ʭ'},  {U'ʲ', U'ʶ'},  {U'ʽ', U'ˋ'},  
+    {U'˖', U'˙'},    {U'˶', U'˶'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'},    {U'"', U'%'},    {U'(', U'/'},    {U'2', U'6'},    
+    {U'G', U'R'},      {U'U', U'X'},    {U'Z', U'\\'},   {U'c', U'n'},    
+    { 129,  129},      { 131,  138},    { 144,  148},    { 151,  153},    
+    { 158, U'¡'},     {U'¥', U'´'},  {U'·', U'¼'},  {U'Ç', U'Ë'},  
+    {U'Ñ', U'Ó'},    {U'á', U'è'},  {U'ì', U'ñ'},  {U'Ė', U'ě'},  
+    {U'ĝ', U'Ģ'},    {U'Ĥ', U'ī'},  {U'Ľ', U'Ň'},  {U'œ', U'Ś'},  
+    {U'š', U'Ť'},    {U'ŧ', U'Ũ'},  {U'Ŭ', U'ŭ'},  {U'Ŵ', U'ŵ'},  
+    {U'ŷ', U'Ÿ'},    {U'ż', U'Ž'},  {U'Ɩ', U'Ƙ'},  {U'ƚ', U'ƞ'},  
+    {U'Ƨ', U'Ƨ'},    {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  {U'Ǉ', U'ǐ'},  
+    {U'ǚ', U'Ǟ'},    {U'Ǣ', U'Ǩ'},  {U'Ǳ', U'Ǵ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'ȁ'},    {U'ȑ', U'ȑ'},  {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  
+    {U'Ȳ', U'Ȳ'},    {U'ȵ', U'ȹ'},  {U'Ƀ', U'Ʌ'},  {U'ə', U'ə'},  
+    {U'ɮ', U'ɯ'},    {U'ʑ', U'ʑ'},  {U'ʤ', U'ʩ'},  {U'ʬ', U'ʭ'},  
+    {U'ʰ', U'ʱ'},    {U'˦', U'˩'},  {U'˻', U'˼'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    57,  116,  173,  227,  288,  345,  405,  
+    461
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113864,  275,  297,  263,  298,  277,  315,  271
+};
+
+} // namespace synthetic_table_128
+
@@ -0,0 +1,69 @@
+#include "synthetic_table_16.h"
+
+namespace synthetic_table_16{
+extern const Segment_with_value<uint8_t, Categories_set> categories_table[] = {
+    {{U'J', U'P'}, 0x69},   {{U'3', U'9'}, 0xDA},  {{U'`', U'b'}, 0xB0},  
+    {{U'+', U'0'},  0xF},   {{U'C', U'C'}, 0x8C},  {{U'S', U'W'}, 0x8F},  
+    {{U'i', U'm'}, 0xB4},   {{U')', U'*'}, 0x4F},  {{U'1', U'2'}, 0xC4},  
+    {{U'<', U'B'}, 0x31},   {{U'G', U'I'}, 0x53},  {{U'R', U'R'}, 0x15},  
+    {{U'[', U'_'}, 0xFF},   {{U'd', U'h'}, 0x21},  {{U'n', U't'}, 0xC6},  
+    {{U'!', U'\''}, 0xF6}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
+    0x1,  0x4F, 0x4F, 0xF,  0xF,  0xF,  0xF,  0xF,  
+    0xF,  0xC4, 0xC4, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 
+    0xDA, 0xDA, 0x1,  0x1,  0x31, 0x31, 0x31, 0x31, 
+    0x31, 0x31, 0x31, 0x8C, 0x1,  0x1,  0x1,  0x53, 
+    0x53, 0x53, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x1,  0x15, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x1,  0x1,  0x1,  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xB0, 0xB0, 0xB0, 0x1,  0x21, 0x21, 0x21, 0x21, 
+    0x21, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC6, 0xC6, 
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x3F, 0x33, 0x33, 0x63, 0x73, 0xF3, 0xF3, 0xF3, 0xF7, 0xB7, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 
+    0x88, 0x84, 0x84, 0xAC, 0xAC, 0x2C, 0x2C, 0x3C, 0x18, 0x1C, 0x4,  0x24, 0x24, 0x24, 0x64, 0x64, 
+    0x88, 0x8C, 0xAC, 0xB4, 0xA4, 0x24, 0x24, 0x24, 0x0,  0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64, 
+    0x28, 0x0,  0x0,  0x38, 0x28, 0x28, 0x28, 0x28, 0x8,  0xC,  0x14, 0x34, 0x34, 0x34, 0x34, 0x34, 
+    0x50, 0x54, 0x74, 0xC,  0xC,  0xC,  0xC,  0x1C, 0x18, 0x58, 0x40, 0x60, 0x68, 0x68, 0x28, 0x28, 
+    0x70, 0x54, 0x54, 0x4,  0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x50, 0x70, 0x78, 0x78, 0x38, 0x38, 
+    0xA0, 0x8C, 0x8C, 0x8C, 0x8C, 0xC,  0xC,  0x1C, 0x18, 0x1C, 0x14, 0x30, 0x30, 0x30, 0x70, 0x70, 
+    0xC0, 0xCC, 0xCC, 0xBC, 0xAC, 0x2C, 0x2C, 0x2C, 0x8,  0x48, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0,   32},   {U'(', U'0'},     {U':', U'B'},   {U'D', U'_'},   
+    {U'c', U'h'},   {U'u', 1114111},  {U'!', U'\''},  {U')', U'0'},   
+    {U'3', U'9'},   {U'G', U'I'},     {U'S', U'W'},   {U'[', U'_'},   
+    {U'n', U't'},   {U'!', U'\''},    {U')', U'2'},   {U'C', U'C'},   
+    {U'R', U'W'},   {U'[', U'_'},     {U'i', U't'},   {U')', U'0'},   
+    {U'3', U'9'},   {U'C', U'C'},     {U'J', U'P'},   {U'S', U'W'},   
+    {U'[', U'_'},   {U'!', U'\''},    {U'3', U'9'},   {U'<', U'B'},   
+    {U'G', U'I'},   {U'R', U'R'},     {U'[', U'b'},   {U'i', U'm'},   
+    {U'!', U'\''},  {U'<', U'B'},     {U'J', U'P'},   {U'[', U'b'},   
+    {U'd', U'm'},   {U'!', U'\''},    {U')', U'*'},   {U'1', U'9'},   
+    {U'G', U'P'},   {U'[', U'_'},     {U'n', U't'},   {U'!', U'\''},  
+    {U'1', U'9'},   {U'C', U'C'},     {U'S', U'W'},   {U'[', U'b'},   
+    {U'i', U't'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   6,  13,  19,  25,  32,  37,  43,  
+    49
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114080,  42,  41,  33,  38,  39,  40,  42
+};
+
+} // namespace synthetic_table_16
+
@@ -0,0 +1,361 @@
+#include "synthetic_table_256.h"
+
+namespace synthetic_table_256{
+extern const Segment_with_value<uint16_t, Categories_set> categories_table[] = {
+    {{U'̑', U'̓'}, 0x96},  {{U'ſ', U'ƃ'}, 0xEB},  {{U'ѳ', U'Ѵ'}, 0x7D},  
+    {{U'Ê', U'Ð'}, 0xBF},  {{U'ɒ', U'ɗ'}, 0x7B},  {{U'υ', U'ό'}, 0x5B},  
+    {{U'Կ', U'Յ'}, 0x5D},  {{U'o', U'q'}, 0x64},    {{U'ħ', U'ĩ'}, 0xD7},  
+    {{U'ǭ', U'Ǵ'}, 0x4A},  {{U'ʳ', U'ʶ'}, 0xB3},  {{U'ͪ', U'ͭ'}, 0xEA},  
+    {{U'И', U'О'}, 0x47},  {{U'Ӕ', U'ӗ'}, 0x7E},  {{U'֢', U'֢'}, 0xAC},  
+    {{U'I', U'P'}, 0xE9},    {{ 156, U' '}, 0x1D},   {{U'ð', U'ö'}, 0x35},  
+    {{U'ň', U'ō'}, 0x50},  {{U'Ʋ', U'Ƶ'}, 0xEA},  {{U'ȫ', U'Ȭ'}, 0xB9},  
+    {{U'ɹ', U'ɽ'}, 0xB3},  {{U'ˣ', U'˦'}, 0x10},  {{U'̼', U'́'}, 0xAF},  
+    {{U'ΐ', U'Β'},  0x2},  {{U'϶', U'ϸ'}, 0xD1},  {{U'ю', U'ѐ'}, 0xD9},  
+    {{U'Ҥ', U'ҫ'}, 0xEB},  {{U'ԇ', U'ԍ'}, 0xD6},  {{U'ձ', U'շ'}, 0x32},  
+    {{U'ד', U'ה'}, 0xAD},  {{U'3', U'3'}, 0x8B},    {{U'\\', U'_'}, 0x1A},   
+    {{ 139,  140}, 0x44},    {{U'·', U'½'}, 0x8A},  {{U'á', U'â'}, 0x38},  
+    {{U'ĉ', U'č'},  0xA},  {{U'ĺ', U'Ľ'}, 0x50},  {{U'Š', U'ŧ'}, 0x24},  
+    {{U'ƙ', U'Ɵ'}, 0x88},  {{U'Ǌ', U'ǎ'}, 0xF8},  {{U'ȉ', U'Ȏ'}, 0xD8},  
+    {{U'ɀ', U'Ɂ'}, 0x83},  {{U'ɩ', U'ɩ'}, 0xE6},  {{U'ʗ', U'ʙ'}, 0x59},  
+    {{U'ˋ', U'ˑ'}, 0x65},  {{U'˸', U'˼'}, 0xF3},  {{U'̨', U'̨'}, 0xDF},  
+    {{U'͒', U'͔'}, 0xAA},  {{U'ͻ', U';'}, 0x12},  {{U'Ω', U'Ϊ'}, 0xE9},  
+    {{U'ϣ', U'ϧ'}, 0x20},  {{U'Ѓ', U'Ј'}, 0x72},  {{U'е', U'ж'}, 0x36},  
+    {{U'ѝ', U'џ'}, 0x44},  {{U'҈', U'Ҍ'}, 0x6D},  {{U'Ҽ', U'ҽ'}, 0x94},  
+    {{U'ӱ', U'ӵ'}, 0x3A},  {{U'Ԧ', U'ԭ'}, 0xA1},  {{U'՝', U'՝'}, 0xDE},  
+    {{U'֍', U'֍'}, 0xAB},  {{U'ָ', U'־'}, 0x79},  {{U'ש', U'׭'}, 0x6D},  
+    {{U'&', U','}, 0x72},    {{U'=', U'C'}, 0x18},    {{U'U', U'U'}, 0x2A},    
+    {{U'i', U'i'}, 0x1F},    {{U'|',  131}, 0xDC},    {{ 146,  147},  0xF},    
+    {{U'«', U'¯'}, 0x1E},  {{U'Á', U'Ç'}, 0x5C},  {{U'Ù', U'Û'}, 0xE5},  
+    {{U'ç', U'ë'}, 0x73},  {{U'ø', U'þ'}, 0x2E},  {{U'ė', U'Ĝ'}, 0x85},  
+    {{U'ı', U'ĳ'}, 0xBC},  {{U'Ń', U'Ń'}, 0xC8},  {{U'Ŗ', U'Ř'}, 0x3A},  
+    {{U'Ű', U'ų'}, 0x8E},  {{U'Ɗ', U'Ǝ'}, 0xFD},  {{U'ƪ', U'ƫ'}, 0x52},  
+    {{U'Ƽ', U'ǂ'}, 0xC5},  {{U'Ǘ', U'Ǟ'}, 0xD8},  {{U'ǽ', U'ǽ'}, 0x15},  
+    {{U'Ȝ', U'ȡ'}, 0x97},  {{U'ȳ', U'ȸ'}, 0x1B},  {{U'Ɋ', U'Ɍ'}, 0xB7},  
+    {{U'ɛ', U'ɞ'}, 0xA1},  {{U'ɰ', U'ɴ'}, 0x4F},  {{U'ʈ', U'ʉ'}, 0x29},  
+    {{U'ʣ', U'ʪ'}, 0x12},  {{U'ʾ', U'ˀ'}, 0x63},  {{U'˖', U'˗'}, 0x2A},  
+    {{U'˯', U'˯'}, 0xF9},  {{U'̄', U'̋'}, 0x1C},  {{U'̡', U'̤'}, 0xE4},  
+    {{U'̮', U'̳'}, 0x44},  {{U'͇', U'͇'}, 0x63},  {{U'͞', U'͢'}, 0xD1},  
+    {{U'ʹ', U'͵'}, 0x35},  {{U'Έ', U'΍'}, 0x38},  {{U'Η', U'Ν'}, 0x53},  
+    {{U'ε', U'κ'}, 0xB5},  {{U'ϖ', U'Ϛ'}, 0x4A},  {{U'Ϯ', U'ϰ'}, 0xB8},  
+    {{U'Ͼ', U'Ͽ'}, 0x56},  {{U'Ў', U'Џ'}, 0xC4},  {{U'Ч', U'Ю'}, 0x8E},  
+    {{U'о', U'ф'}, 0x1A},  {{U'є', U'є'}, 0xA0},  {{U'ѫ', U'ѭ'}, 0x24},  
+    {{U'Ѽ', U'҃'}, 0x3A},  {{U'ҕ', U'ҙ'}, 0x38},  {{U'Ү', U'Ҳ'}, 0xFF},  
+    {{U'Ӄ', U'ӊ'}, 0x2C},  {{U'ӣ', U'Ө'}, 0xDB},  {{U'Ӿ', U'ӿ'},  0x7},  
+    {{U'ԗ', U'Ԝ'}, 0x4D},  {{U'Ե', U'Զ'}, 0x5D},  {{U'Վ', U'Ք'}, 0xF7},  
+    {{U'է', U'է'},  0xB},  {{U'վ', U'վ'}, 0x9D},  {{U'֕', U'֘'}, 0xD3},  
+    {{U'֪', U'ֱ'}, 0xA4},  {{U'׃', U'׆'}, 0x98},  {{U'ך', U'נ'}, 0x4A},  
+    {{U'״', U'׺'}, 0x4E},  {{U'$', U'$'}, 0x50},    {{U'-', U'0'}, 0xCC},    
+    {{U'4', U':'}, 0x51},    {{U'D', U'F'}, 0x25},    {{U'R', U'R'}, 0x52},    
+    {{U'V', U'Z'}, 0xD4},    {{U'`', U'f'}, 0x33},    {{U'j', U'm'}, 0x58},    
+    {{U'u', U'{'}, 0x5F},    {{ 134,  136}, 0x26},    {{ 143,  143}, 0xDB},    
+    {{ 151,  153}, 0xFD},    {{U'¤', U'©'}, 0xB2},  {{U'²', U'³'}, 0x95},  
+    {{U'¾', U'À'}, 0xDC},  {{U'È', U'È'}, 0x87},  {{U'Ô', U'Ö'}, 0xFF},  
+    {{U'Ü', U'ß'}, 0xA2},  {{U'ä', U'æ'}, 0x33},  {{U'ï', U'ï'}, 0xCB},  
+    {{U'÷', U'÷'}, 0x86},  {{U'Ă', U'ą'}, 0xEB},  {{U'đ', U'ĕ'}, 0x47},  
+    {{U'Ġ', U'Ĥ'}, 0xFE},  {{U'ī', U'İ'}, 0xF4},  {{U'ĵ', U'ĸ'}, 0xDC},  
+    {{U'ŀ', U'ł'}, 0x37},  {{U'ņ', U'ņ'}, 0x5D},  {{U'Ŏ', U'Œ'}, 0x33},  
+    {{U'ř', U'Ş'}, 0xF7},  {{U'Ũ', U'ŭ'}, 0xD4},  {{U'Ŷ', U'Ż'}, 0xCF},  
+    {{U'ƅ', U'ƈ'}, 0xB3},  {{U'ƒ', U'Ƙ'},  0xB},  {{U'Ƣ', U'Ʃ'}, 0xB5},  
+    {{U'Ƭ', U'Ʊ'}, 0x2A},  {{U'ƶ', U'Ƹ'}, 0xB2},  {{U'ǆ', U'ǈ'}, 0x70},  
+    {{U'ǒ', U'Ǔ'}, 0x46},  {{U'Ǣ', U'ǩ'}, 0x4C},  {{U'Ƕ', U'ǹ'}, 0x63},  
+    {{U'Ȁ', U'Ȇ'},  0x5},  {{U'Ȓ', U'ș'}, 0x44},  {{U'ȣ', U'Ȩ'}, 0x70},  
+    {{U'Ȱ', U'Ȳ'}, 0x43},  {{U'ȹ', U'Ⱦ'}, 0x41},  {{U'Ƀ', U'Ɉ'}, 0xB9},  
+    {{U'Ɏ', U'ɐ'}, 0xB7},  {{U'ɘ', U'ɚ'}, 0xAA},  {{U'ɢ', U'ɦ'}, 0xD9},  
+    {{U'ɫ', U'ɯ'}, 0xAB},  {{U'ɵ', U'ɶ'}, 0xB7},  {{U'ʁ', U'ʄ'}, 0xE0},  
+    {{U'ʍ', U'ʔ'}, 0x33},  {{U'ʜ', U'ʡ'}, 0xA9},  {{U'ʭ', U'ʯ'}, 0x8F},  
+    {{U'ʺ', U'ʼ'}, 0xEF},  {{U'ˁ', U'ˈ'}, 0xB6},  {{U'˓', U'˕'}, 0x2E},  
+    {{U'˛', U'ˠ'}, 0xC9},  {{U'˧', U'˫'}, 0x42},  {{U'˲', U'˷'}, 0x4E},  
+    {{U'˿', U'̃'}, 0x58},  {{U'̎', U'̐'}, 0xA9},  {{U'̗', U'̝'}, 0x3E},  
+    {{U'̥', U'̦'}, 0xA4},  {{U'̬', U'̭'}, 0x94},  {{U'̶', U'̻'}, 0x86},  
+    {{U'͂', U'͆'}, 0xA7},  {{U'͊', U'͏'}, 0xB0},  {{U'͗', U'͜'}, 0x66},  
+    {{U'ͦ', U'ͨ'}, 0x64},  {{U'Ͱ', U'Ͳ'}, 0x95},  {{U'ͷ', U'͸'}, 0xE2},  
+    {{U'Ϳ', U'΄'}, 0x80},  {{U'Ώ', U'Ώ'}, 0xC2},  {{U'Δ', U'Ζ'}, 0xC8},  
+    {{U'Ρ', U'Υ'}, 0xA0},  {{U'ή', U'γ'}, 0xF7},  {{U'ξ', U'τ'}, 0xA7},  
+    {{U'ύ', U'ϒ'}, 0xDB},  {{U'ϝ', U'Ϣ'}, 0x37},  {{U'Ϩ', U'ϫ'}, 0xF8},  
+    {{U'ϴ', U'ϵ'}, 0x5A},  {{U'Ϲ', U'ϼ'}, 0xD6},  {{U'Ѐ', U'Ђ'}, 0x59},  
+    {{U'Њ', U'Ћ'}, 0xF9},  {{U'В', U'Ж'},  0xC},  {{U'П', U'У'}, 0x88},  
+    {{U'б', U'б'}, 0x12},  {{U'з', U'к'}, 0x96},  {{U'ц', U'э'}, 0xDC},  
+    {{U'ё', U'ђ'}, 0xAA},  {{U'ј', U'ќ'}, 0xF0},  {{U'Ѡ', U'ѧ'}, 0x1D},  
+    {{U'Ѱ', U'Ѳ'}, 0x14},  {{U'ѵ', U'Ѹ'}, 0x57},  {{U'҅', U'҅'}, 0xB8},  
+    {{U'ҏ', U'ґ'}, 0xE2},  {{U'Ҝ', U'Ҡ'}, 0x3D},  {{U'Ҭ', U'Ҭ'}, 0xBD},  
+    {{U'ҳ', U'ҹ'}, 0xC8},  {{U'Ҿ', U'Ӂ'}, 0xCE},  {{U'Ӎ', U'Ӓ'}, 0x23},  
+    {{U'ӛ', U'ӡ'}, 0x68},  {{U'Ӭ', U'Ӯ'}, 0x2C},  {{U'Ӹ', U'Ӽ'}, 0x43},  
+    {{U'ԃ', U'Ԅ'}, 0x4B},  {{U'Ԑ', U'Ԗ'}, 0x61},  {{U'Ԟ', U'Ԣ'}, 0xE2},  
+    {{U'԰', U'Ա'}, 0xDA},  {{U'Է', U'Լ'}, 0xA9},  {{U'Չ', U'Ս'}, 0x96},  
+    {{U'՘', U'՛'}, 0x4B},  {{U'ՠ', U'զ'}, 0x4F},  {{U'ժ', U'ծ'}, 0xA4},  
+    {{U'ո', U'ջ'}, 0xF2},  {{U'ւ', U'։'}, 0xA4},  {{U'֏', U'֑'}, 0xEB},  
+    {{U'֙', U'֞'}, 0x7E},  {{U'֥', U'֧'}, 0xC4},  {{U'ֳ', U'ַ'}, 0xBB},  
+    {{U'ֿ', U'ׁ'}, 0xA9},  {{U'׊', U'א'}, 0xAA},  {{U'ז', U'ח'}, 0x5E},  
+    {{U'פ', U'ר'}, 0xE3},  {{U'װ', U'ױ'}, 0x1D},  {{U'׽', U'׽'}, 0xAF},  
+    {{  32, U'"'}, 0x4C}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x4C, 0x4C, 0x4C, 0x1,  0x50, 0x1,  0x72, 0x72, 
+    0x72, 0x72, 0x72, 0x72, 0x72, 0xCC, 0xCC, 0xCC, 
+    0xCC, 0x1,  0x1,  0x8B, 0x51, 0x51, 0x51, 0x51, 
+    0x51, 0x51, 0x51, 0x1,  0x1,  0x18, 0x18, 0x18, 
+    0x18, 0x18, 0x18, 0x18, 0x25, 0x25, 0x25, 0x1,  
+    0x1,  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 
+    0xE9, 0x1,  0x52, 0x1,  0x1,  0x2A, 0xD4, 0xD4, 
+    0xD4, 0xD4, 0xD4, 0x1,  0x1A, 0x1A, 0x1A, 0x1A, 
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1,  
+    0x1,  0x1F, 0x58, 0x58, 0x58, 0x58, 0x1,  0x64, 
+    0x64, 0x64, 0x1,  0x1,  0x1,  0x5F, 0x5F, 0x5F, 
+    0x5F, 0x5F, 0x5F, 0x5F, 0xDC, 0xDC, 0xDC, 0xDC
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x63, 0x6B, 0xCB, 0xEF, 0xFB, 0xDF, 0xDB, 0xDB, 0xDB, 0xDB, 0x9B, 0xBB, 0x1B, 0x13, 0x53, 0x13, 
+    0x40, 0x40, 0x60, 0x48, 0x40, 0xE0, 0xC4, 0x84, 0x84, 0xC4, 0x84, 0x84, 0x24, 0x20, 0x20, 0x20, 
+    0x8C, 0x84, 0x4,  0x0,  0x10, 0x90, 0xB0, 0xA0, 0xA0, 0xE0, 0xA0, 0x80, 0x80, 0x84, 0x84, 0xC4, 
+    0x3C, 0x14, 0x14, 0x18, 0x0,  0xA0, 0x80, 0x80, 0x80, 0xD0, 0xD0, 0xD0, 0xF0, 0xFC, 0xBC, 0xBC, 
+    0x50, 0x50, 0x70, 0x50, 0x4C, 0xC8, 0xEC, 0xAC, 0xAC, 0xEC, 0xEC, 0xC4, 0xE4, 0xE8, 0xA8, 0xA8, 
+    0xE0, 0xC0, 0x40, 0x40, 0x50, 0x70, 0x54, 0x4,  0x4,  0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x50, 
+    0xAC, 0x84, 0x24, 0x0,  0xC,  0x88, 0xAC, 0xAC, 0xAC, 0xBC, 0xFC, 0xD4, 0xD4, 0xD4, 0x94, 0xD4, 
+    0x28, 0x0,  0x0,  0x8,  0x0,  0x0,  0x20, 0x20, 0x20, 0x30, 0x30, 0x10, 0x90, 0x94, 0x94, 0x94
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0,   31},      {U'#', U'#'},    {U'%', U'%'},    {U'1', U'<'},    
+    {U'D', U'Q'},      {U'S', U'T'},    {U'[', U'['},    {U'`', U'i'},    
+    {U'n', U'n'},      {U'r', U'{'},    { 132,  133},    { 137,  138},    
+    { 141, U'£'},     {U'ª', U'ª'},  {U'°', U'¶'},  {U'È', U'Û'},  
+    {U'à', U'à'},    {U'ã', U'ö'},  {U'ÿ', U'Ĉ'},  {U'Ď', U'ğ'},  
+    {U'ĥ', U'Ī'},    {U'Ĵ', U'Ĵ'},  {U'Ĺ', U'Ĺ'},  {U'ľ', U'ł'},  
+    {U'ń', U'Ň'},    {U'Ŏ', U'ŕ'},  {U'ř', U'ş'},  {U'Ů', U'ů'},  
+    {U'Ŵ', U'Ƙ'},    {U'Ơ', U'Ʃ'},  {U'ƹ', U'ǅ'},  {U'ǉ', U'ǉ'},  
+    {U'Ǐ', U'Ǒ'},    {U'ǔ', U'ǖ'},  {U'ǟ', U'ǡ'},  {U'Ǫ', U'Ǭ'},  
+    {U'ǵ', U'Ȉ'},    {U'ȏ', U'ȑ'},  {U'Ț', U'Ȣ'},  {U'ȩ', U'ɗ'},  
+    {U'ɛ', U'ɨ'},    {U'ɪ', U'ʀ'},  {U'ʅ', U'ʢ'},  {U'ʫ', U'ˀ'},  
+    {U'ˉ', U'˒'},    {U'˘', U'ˢ'},  {U'ˬ', U'˱'},  {U'˸', U'˾'},  
+    {U'̌', U'̐'},    {U'̔', U'̖'},  {U'̞', U'̠'},  {U'̧', U'̫'},  
+    {U'̴', U'̵'},    {U'̼', U'͉'},  {U'͐', U'͑'},  {U'͕', U'͖'},  
+    {U'͝', U'ͥ'},    {U'ͩ', U'ͩ'},  {U'ͮ', U'Ͷ'},  {U'͹', U'ͺ'},  
+    {U'΅', U'·'},    {U'Ύ', U'Ύ'},  {U'Γ', U'Γ'},  {U'Η', U'Π'},  
+    {U'Φ', U'ϕ'},    {U'ϛ', U'Ϣ'},  {U'Ϭ', U'ϭ'},  {U'ϱ', U'ϳ'},  
+    {U'϶', U'ϸ'},    {U'Ͻ', U'Ͻ'},  {U'Ѐ', U'Ђ'},  {U'Љ', U'Ѝ'},  
+    {U'А', U'Б'},    {U'З', U'О'},  {U'Ф', U'Ц'},  {U'Я', U'а'},  
+    {U'в', U'д'},    {U'л', U'н'},  {U'х', U'х'},  {U'ю', U'ѐ'},  
+    {U'ѓ', U'ѓ'},    {U'ѕ', U'ї'},  {U'Ѡ', U'Ѫ'},  {U'Ѯ', U'ѯ'},  
+    {U'ѳ', U'ѻ'},    {U'҄', U'҄'},  {U'҆', U'Ҏ'},  {U'Ғ', U'Ҕ'},  
+    {U'Қ', U'Ҳ'},    {U'Һ', U'һ'},  {U'ӂ', U'ӂ'},  {U'Ӌ', U'ӓ'},  
+    {U'Ә', U'Ӛ'},    {U'Ӣ', U'ӫ'},  {U'ӯ', U'Ӱ'},  {U'Ӷ', U'Ԇ'},  
+    {U'Ԏ', U'ԝ'},    {U'ԣ', U'ԯ'},  {U'Բ', U'Ո'},  {U'Վ', U'՜'},  
+    {U'՞', U'թ'},    {U'կ', U'հ'},  {U'ռ', U'ց'},  {U'֊', U'֘'},  
+    {U'֟', U'֡'},    {U'֣', U'֤'},  {U'֨', U'֩'},  {U'ֲ', U'ׂ'},  
+    {U'ׇ', U'׉'},    {U'ב', U'ו'},  {U'ט', U'י'},  {U'ס', U'׳'},  
+    {U'׻', 1114111},  {U'&', U','},    {U'3', U'3'},    {U'R', U'R'},    
+    {U'U', U'U'},      {U'\\', U'f'},   {U'i', U'i'},    {U'u', U'{'},    
+    { 134,  136},      { 143,  143},    { 146,  147},    {U'¤', U'©'},  
+    {U'«', U'¯'},    {U'·', U'½'},  {U'È', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ü', U'ß'},  {U'ä', U'ë'},  {U'ï', U'ï'},  
+    {U'÷', U'þ'},    {U'Ă', U'ą'},  {U'ĉ', U'č'},  {U'đ', U'ĕ'},  
+    {U'Ġ', U'Ĥ'},    {U'ħ', U'ĩ'},  {U'ŀ', U'ł'},  {U'Ŏ', U'Œ'},  
+    {U'Ŗ', U'Ş'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'ƅ', U'ƈ'},    {U'ƒ', U'Ƙ'},  {U'ƪ', U'Ƹ'},  {U'ǒ', U'Ǔ'},  
+    {U'ǭ', U'Ǵ'},    {U'Ƕ', U'ǹ'},  {U'Ȝ', U'ȡ'},  {U'Ȱ', U'ȸ'},  
+    {U'ɀ', U'Ɂ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɚ'},  
+    {U'ɩ', U'ɩ'},    {U'ɫ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʍ', U'ʔ'},  
+    {U'ʣ', U'ʪ'},    {U'ʭ', U'ʯ'},  {U'ʳ', U'ʶ'},  {U'ʺ', U'ʼ'},  
+    {U'ʾ', U'ˈ'},    {U'˓', U'˗'},  {U'˧', U'˫'},  {U'˲', U'˼'},  
+    {U'̑', U'̓'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̶', U'͇'},  
+    {U'͒', U'͔'},    {U'͗', U'͜'},  {U'ͪ', U'ͭ'},  {U'ͷ', U'͸'},  
+    {U'ͻ', U';'},    {U'Ώ', U'Β'},  {U'Η', U'Ν'},  {U'ή', U'γ'},  
+    {U'ξ', U'ϒ'},    {U'ϖ', U'Ϛ'},  {U'ϝ', U'Ϣ'},  {U'ϴ', U'ϵ'},  
+    {U'Ϲ', U'ϼ'},    {U'Ͼ', U'Ͽ'},  {U'Ѓ', U'Ј'},  {U'И', U'О'},  
+    {U'Ч', U'Ю'},    {U'б', U'б'},  {U'е', U'к'},  {U'о', U'ф'},  
+    {U'ё', U'ђ'},    {U'ѵ', U'Ѹ'},  {U'Ѽ', U'҃'},  {U'ҏ', U'ґ'},  
+    {U'Ҥ', U'ҫ'},    {U'Ү', U'Ҳ'},  {U'Ҿ', U'Ӂ'},  {U'Ӎ', U'Ӓ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӣ', U'Ө'},  {U'ӱ', U'ӵ'},  {U'Ӹ', U'Ӽ'},  
+    {U'Ӿ', U'ӿ'},    {U'ԃ', U'Ԅ'},  {U'ԇ', U'ԍ'},  {U'Ԟ', U'Ԣ'},  
+    {U'԰', U'Ա'},    {U'Չ', U'Ք'},  {U'՘', U'՛'},  {U'՝', U'՝'},  
+    {U'ՠ', U'է'},    {U'ձ', U'ջ'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֕', U'֞'},    {U'ֳ', U'ַ'},  {U'׊', U'א'},  {U'ז', U'ח'},  
+    {U'ך', U'נ'},    {U'פ', U'ר'},  {U'״', U'׺'},  {U'׽', U'׽'},  
+    {  32, U'"'},      {U'-', U'0'},    {U'D', U'F'},    {U'V', U'Z'},    
+    {U'i', U'i'},      {U'o', U'q'},    {U'u',  131},    { 134,  136},    
+    { 139,  140},      { 146,  147},    { 151,  153},    { 156, U' '},   
+    {U'«', U'¯'},    {U'²', U'³'},  {U'¾', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'Û'},  {U'ð', U'þ'},  {U'đ', U'ĕ'},  
+    {U'ė', U'Ĝ'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'ĳ'},  
+    {U'ĵ', U'ĸ'},    {U'ŀ', U'ł'},  {U'ņ', U'ņ'},  {U'ř', U'Ş'},  
+    {U'Š', U'ŭ'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'Ɗ', U'Ǝ'},  
+    {U'Ƣ', U'Ʃ'},    {U'Ƽ', U'ǂ'},  {U'ǒ', U'Ǔ'},  {U'Ǣ', U'ǩ'},  
+    {U'ǽ', U'ǽ'},    {U'Ȁ', U'Ȇ'},  {U'Ȓ', U'ș'},  {U'Ȝ', U'ȡ'},  
+    {U'Ɋ', U'Ɍ'},    {U'Ɏ', U'ɐ'},  {U'ɩ', U'ɩ'},  {U'ɰ', U'ɶ'},  
+    {U'ʭ', U'ʯ'},    {U'ʺ', U'ʼ'},  {U'ˁ', U'ˈ'},  {U'ˋ', U'ˑ'},  
+    {U'˓', U'˕'},    {U'˲', U'˷'},  {U'̄', U'̋'},  {U'̑', U'̓'},  
+    {U'̗', U'̝'},    {U'̡', U'̦'},  {U'̨', U'̨'},  {U'̬', U'̳'},  
+    {U'̶', U'͆'},    {U'͗', U'͜'},  {U'ͦ', U'ͨ'},  {U'Ͱ', U'Ͳ'},  
+    {U'ʹ', U'͵'},    {U'ή', U'γ'},  {U'ε', U'κ'},  {U'ξ', U'τ'},  
+    {U'ϝ', U'Ϣ'},    {U'Ϲ', U'ϼ'},  {U'Ͼ', U'Ͽ'},  {U'Ў', U'Џ'},  
+    {U'В', U'Ж'},    {U'И', U'О'},  {U'Ч', U'Ю'},  {U'е', U'к'},  
+    {U'ц', U'э'},    {U'ѝ', U'ѧ'},  {U'ѫ', U'ѭ'},  {U'Ѱ', U'Ѹ'},  
+    {U'҈', U'Ҍ'},    {U'Ҝ', U'Ҡ'},  {U'Ҭ', U'Ҭ'},  {U'Ү', U'Ҳ'},  
+    {U'Ҽ', U'Ӂ'},    {U'Ӄ', U'ӊ'},  {U'Ӕ', U'ӗ'},  {U'Ӭ', U'Ӯ'},  
+    {U'Ӿ', U'ӿ'},    {U'ԇ', U'ԍ'},  {U'ԗ', U'Ԝ'},  {U'Ե', U'Զ'},  
+    {U'Կ', U'Յ'},    {U'Չ', U'Ք'},  {U'՝', U'՝'},  {U'ՠ', U'զ'},  
+    {U'ժ', U'ծ'},    {U'վ', U'վ'},  {U'ւ', U'։'},  {U'֙', U'֞'},  
+    {U'֢', U'֢'},    {U'֥', U'֧'},  {U'֪', U'ֱ'},  {U'ד', U'ה'},  
+    {U'ז', U'ח'},    {U'ש', U'׭'},  {U'װ', U'ױ'},  {U'״', U'׺'},  
+    {U'׽', U'׽'},    {  32, U'"'},    {U'-', U'0'},    {U'3', U'3'},    
+    {U'=', U'C'},      {U'I', U'P'},    {U'U', U'U'},    {U'\\', U'_'},   
+    {U'i', U'm'},      {U'u',  131},    { 143,  143},    { 146,  147},    
+    { 151,  153},      { 156, U' '},   {U'«', U'¯'},  {U'·', U'Ç'},  
+    {U'Ê', U'Ð'},    {U'Ô', U'Ö'},  {U'á', U'â'},  {U'ï', U'ï'},  
+    {U'ø', U'þ'},    {U'Ă', U'ą'},  {U'ĉ', U'č'},  {U'Ġ', U'Ĥ'},  
+    {U'ı', U'ĳ'},    {U'ĵ', U'ĸ'},  {U'Ń', U'Ń'},  {U'ņ', U'ņ'},  
+    {U'Ŗ', U'Ř'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'Ɗ', U'Ǝ'},    {U'ƒ', U'Ɵ'},  {U'Ƭ', U'Ƶ'},  {U'Ǌ', U'ǎ'},  
+    {U'Ǘ', U'Ǟ'},    {U'Ǣ', U'ǩ'},  {U'ǭ', U'Ǵ'},  {U'ȉ', U'Ȏ'},  
+    {U'ȫ', U'Ȭ'},    {U'ȳ', U'ȸ'},  {U'Ƀ', U'Ɉ'},  {U'ɒ', U'ɚ'},  
+    {U'ɢ', U'ɦ'},    {U'ɫ', U'ɴ'},  {U'ʈ', U'ʉ'},  {U'ʗ', U'ʙ'},  
+    {U'ʜ', U'ʡ'},    {U'ʭ', U'ʯ'},  {U'ʺ', U'ʼ'},  {U'˓', U'˗'},  
+    {U'˛', U'ˠ'},    {U'˯', U'˯'},  {U'˲', U'˷'},  {U'˿', U'̋'},  
+    {U'̎', U'̐'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̼', U'́'},  
+    {U'͒', U'͔'},    {U'ͪ', U'ͭ'},  {U'Έ', U'΍'},  {U'Δ', U'Ζ'},  
+    {U'Ω', U'Ϊ'},    {U'υ', U'ϒ'},  {U'ϖ', U'Ϛ'},  {U'Ϩ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'ϴ', U'ϵ'},  {U'Ѐ', U'Ђ'},  {U'Њ', U'Ћ'},  
+    {U'В', U'Ж'},    {U'П', U'У'},  {U'Ч', U'Ю'},  {U'о', U'ф'},  
+    {U'ц', U'ђ'},    {U'Ѡ', U'ѧ'},  {U'ѳ', U'Ѵ'},  {U'Ѽ', U'҃'},  
+    {U'҅', U'҅'},    {U'҈', U'Ҍ'},  {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  
+    {U'Ҥ', U'Ҭ'},    {U'Ү', U'ҹ'},  {U'Ҿ', U'Ӂ'},  {U'Ӄ', U'ӊ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӛ', U'ӡ'},  {U'ӣ', U'Ө'},  {U'Ӭ', U'Ӯ'},  
+    {U'ӱ', U'ӵ'},    {U'ԃ', U'Ԅ'},  {U'ԗ', U'Ԝ'},  {U'԰', U'Ա'},  
+    {U'Ե', U'Լ'},    {U'Կ', U'Յ'},  {U'՘', U'՛'},  {U'՝', U'՝'},  
+    {U'ՠ', U'է'},    {U'վ', U'վ'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֙', U'֞'},    {U'֢', U'֢'},  {U'ֳ', U'ׁ'},  {U'׃', U'׆'},  
+    {U'׊', U'א'},    {U'ד', U'ה'},  {U'ז', U'ח'},  {U'ך', U'נ'},  
+    {U'ש', U'׭'},    {U'װ', U'ױ'},  {U'״', U'׺'},  {U'׽', U'׽'},  
+    {U'$', U'$'},      {U'&', U','},    {U'4', U':'},    {U'=', U'C'},    
+    {U'R', U'R'},      {U'V', U'Z'},    {U'\\', U'f'},   {U'i', U'm'},    
+    {U'u',  131},      { 143,  143},    { 151,  153},    { 156, U' '},   
+    {U'¤', U'©'},    {U'«', U'¯'},  {U'²', U'³'},  {U'¾', U'Ç'},  
+    {U'Ê', U'Ð'},    {U'Ô', U'Ö'},  {U'á', U'â'},  {U'ä', U'ë'},  
+    {U'ð', U'ö'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'ĳ'},  
+    {U'ĵ', U'ĸ'},    {U'ĺ', U'Ľ'},  {U'ŀ', U'ł'},  {U'ņ', U'ņ'},  
+    {U'ň', U'Œ'},    {U'Ŗ', U'Ş'},  {U'Ũ', U'ŭ'},  {U'ƅ', U'ƈ'},  
+    {U'Ɗ', U'Ǝ'},    {U'Ƣ', U'ƫ'},  {U'ƶ', U'Ƹ'},  {U'ǆ', U'ǈ'},  
+    {U'Ǌ', U'ǎ'},    {U'Ǘ', U'Ǟ'},  {U'ǽ', U'ǽ'},  {U'ȉ', U'Ȏ'},  
+    {U'Ȝ', U'ȡ'},    {U'ȣ', U'Ȩ'},  {U'ȫ', U'Ȭ'},  {U'ȳ', U'ȸ'},  
+    {U'Ƀ', U'Ɉ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɗ'},  
+    {U'ɢ', U'ɦ'},    {U'ɵ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʍ', U'ʔ'},  
+    {U'ʗ', U'ʙ'},    {U'ʣ', U'ʪ'},  {U'ʳ', U'ʶ'},  {U'ˁ', U'ˈ'},  
+    {U'ˣ', U'˦'},    {U'˯', U'˯'},  {U'˸', U'˼'},  {U'˿', U'̋'},  
+    {U'̑', U'̓'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̬', U'̭'},  
+    {U'͊', U'͏'},    {U'͞', U'͢'},  {U'Ͱ', U'Ͳ'},  {U'ʹ', U'͵'},  
+    {U'ͻ', U';'},    {U'Έ', U'΍'},  {U'Η', U'Ν'},  {U'ή', U'γ'},  
+    {U'ε', U'κ'},    {U'υ', U'ϒ'},  {U'ϝ', U'Ϣ'},  {U'Ϩ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'ϴ', U'ϼ'},  {U'Ͼ', U'Ј'},  {U'Њ', U'Ћ'},  
+    {U'б', U'б'},    {U'е', U'к'},  {U'о', U'ф'},  {U'ц', U'ѐ'},  
+    {U'ј', U'ќ'},    {U'Ѡ', U'ѧ'},  {U'Ѱ', U'Ѹ'},  {U'Ѽ', U'҃'},  
+    {U'҅', U'҅'},    {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  {U'Ҭ', U'Ҭ'},  
+    {U'Ү', U'Ҳ'},    {U'Ҽ', U'ҽ'},  {U'Ӕ', U'ӗ'},  {U'ӣ', U'Ө'},  
+    {U'ӱ', U'ӵ'},    {U'ԇ', U'ԍ'},  {U'԰', U'Ա'},  {U'Ե', U'Զ'},  
+    {U'Կ', U'Յ'},    {U'Չ', U'Ք'},  {U'՝', U'՝'},  {U'ձ', U'ջ'},  
+    {U'վ', U'վ'},    {U'֕', U'֞'},  {U'ֳ', U'־'},  {U'׃', U'׆'},  
+    {U'ז', U'ח'},    {U'װ', U'ױ'},  {U'&', U','},    {U'D', U'F'},    
+    {U'I', U'P'},      {U'U', U'U'},    {U'`', U'f'},    {U'o', U'q'},    
+    { 134,  136},      { 151,  153},    {U'¤', U'©'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'ß'},  {U'á', U'â'},  {U'ä', U'ë'},  
+    {U'ð', U'ö'},    {U'ø', U'þ'},  {U'Ă', U'ą'},  {U'Ġ', U'Ĥ'},  
+    {U'ī', U'ĳ'},    {U'ŀ', U'ł'},  {U'Ŏ', U'Œ'},  {U'Ŗ', U'Ş'},  
+    {U'Š', U'ŧ'},    {U'ſ', U'ƃ'},  {U'ƅ', U'ƈ'},  {U'Ɗ', U'Ǝ'},  
+    {U'Ƣ', U'Ʃ'},    {U'Ƭ', U'Ƹ'},  {U'ǆ', U'ǈ'},  {U'Ǌ', U'ǎ'},  
+    {U'Ƕ', U'ǹ'},    {U'ȣ', U'Ȩ'},  {U'ȫ', U'Ȭ'},  {U'Ƀ', U'Ɉ'},  
+    {U'Ɋ', U'Ɍ'},    {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɞ'},  {U'ɩ', U'ɩ'},  
+    {U'ɫ', U'ɯ'},    {U'ɵ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʁ', U'ʄ'},  
+    {U'ʈ', U'ʉ'},    {U'ʍ', U'ʔ'},  {U'ʜ', U'ʡ'},  {U'ʳ', U'ʶ'},  
+    {U'ʺ', U'ʼ'},    {U'ʾ', U'ˈ'},  {U'ˋ', U'ˑ'},  {U'˓', U'˗'},  
+    {U'˯', U'˯'},    {U'˸', U'˼'},  {U'̎', U'̐'},  {U'̗', U'̝'},  
+    {U'̡', U'̦'},    {U'̼', U'͇'},  {U'͊', U'͏'},  {U'͒', U'͔'},  
+    {U'͗', U'͜'},    {U'ͦ', U'ͨ'},  {U'ͪ', U'ͭ'},  {U'ʹ', U'͵'},  
+    {U'ͷ', U'͸'},    {U'Έ', U'΍'},  {U'Ρ', U'Υ'},  {U'Ω', U'Ϊ'},  
+    {U'ή', U'γ'},    {U'ε', U'κ'},  {U'ξ', U'τ'},  {U'ϝ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'Ѓ', U'Ј'},  {U'Њ', U'Ћ'},  {U'е', U'ж'},  
+    {U'ё', U'ђ'},    {U'є', U'є'},  {U'ј', U'ќ'},  {U'ѫ', U'ѭ'},  
+    {U'ѳ', U'Ѵ'},    {U'Ѽ', U'҃'},  {U'҅', U'҅'},  {U'҈', U'Ҍ'},  
+    {U'ҏ', U'ґ'},    {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  {U'Ҥ', U'Ҭ'},  
+    {U'Ү', U'Ҳ'},    {U'Ӄ', U'ӊ'},  {U'Ӎ', U'Ӓ'},  {U'Ӕ', U'ӗ'},  
+    {U'ӛ', U'ӡ'},    {U'Ӭ', U'Ӯ'},  {U'ӱ', U'ӵ'},  {U'Ԑ', U'Ԗ'},  
+    {U'Ԟ', U'Ԣ'},    {U'Ԧ', U'ԭ'},  {U'Է', U'Լ'},  {U'Վ', U'Ք'},  
+    {U'ժ', U'ծ'},    {U'ձ', U'ջ'},  {U'ւ', U'։'},  {U'֍', U'֍'},  
+    {U'֏', U'֑'},    {U'֙', U'֞'},  {U'֢', U'֢'},  {U'֪', U'ֱ'},  
+    {U'ֳ', U'ׁ'},    {U'׊', U'א'},  {U'ד', U'ה'},  {U'פ', U'׭'},  
+    {U'׽', U'׽'},    {  32, U'"'},    {U'$', U'$'},    {U'&', U'0'},    
+    {U'4', U':'},      {U'I', U'P'},    {U'R', U'R'},    {U'V', U'Z'},    
+    {U'j', U'm'},      {U'o', U'q'},    {U'u',  131},    { 139,  140},    
+    { 143,  143},      { 151,  153},    {U'¾', U'Ç'},  {U'Ô', U'Ö'},  
+    {U'Ù', U'Û'},    {U'ç', U'ë'},  {U'ï', U'ï'},  {U'Ă', U'ą'},  
+    {U'đ', U'ĕ'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'İ'},  
+    {U'ĵ', U'ĸ'},    {U'ĺ', U'Ľ'},  {U'Ń', U'Ń'},  {U'ņ', U'ņ'},  
+    {U'ň', U'ō'},    {U'ř', U'Ş'},  {U'Ũ', U'ŭ'},  {U'Ŷ', U'Ż'},  
+    {U'ſ', U'ƃ'},    {U'Ɗ', U'Ǝ'},  {U'ƪ', U'ƫ'},  {U'Ʋ', U'Ƶ'},  
+    {U'Ƽ', U'ǂ'},    {U'ǆ', U'ǈ'},  {U'Ǌ', U'ǎ'},  {U'ǒ', U'Ǔ'},  
+    {U'Ǘ', U'Ǟ'},    {U'Ǣ', U'ǩ'},  {U'ǭ', U'Ǵ'},  {U'Ƕ', U'ǹ'},  
+    {U'ȉ', U'Ȏ'},    {U'Ȓ', U'ș'},  {U'ȣ', U'Ȩ'},  {U'Ȱ', U'Ȳ'},  
+    {U'ȹ', U'Ⱦ'},    {U'ɒ', U'ɗ'},  {U'ɢ', U'ɦ'},  {U'ɩ', U'ɩ'},  
+    {U'ɰ', U'ɴ'},    {U'ʁ', U'ʄ'},  {U'ʗ', U'ʙ'},  {U'ʺ', U'ʼ'},  
+    {U'ʾ', U'ˀ'},    {U'ˋ', U'ˑ'},  {U'˛', U'ˠ'},  {U'˧', U'˫'},  
+    {U'˯', U'˯'},    {U'˲', U'˼'},  {U'˿', U'̃'},  {U'̡', U'̤'},  
+    {U'̨', U'̨'},    {U'̮', U'̳'},  {U'͇', U'͇'},  {U'͗', U'͜'},  
+    {U'͞', U'͢'},    {U'ͦ', U'ͨ'},  {U'ͪ', U'ͭ'},  {U'ͷ', U'͸'},  
+    {U'Ώ', U'Ώ'},    {U'Δ', U'Ν'},  {U'Ω', U'Ϊ'},  {U'ή', U'γ'},  
+    {U'υ', U'ϒ'},    {U'ϖ', U'Ϛ'},  {U'Ϩ', U'ϫ'},  {U'ϴ', U'ϼ'},  
+    {U'Ͼ', U'Ј'},    {U'Њ', U'Ћ'},  {U'Ў', U'Џ'},  {U'И', U'О'},  
+    {U'ц', U'ѐ'},    {U'ј', U'џ'},  {U'ѳ', U'Ѹ'},  {U'҈', U'Ҍ'},  
+    {U'ҏ', U'ґ'},    {U'Ҥ', U'ҫ'},  {U'Ү', U'ҹ'},  {U'Ҿ', U'Ӂ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӛ', U'ӡ'},  {U'ӣ', U'Ө'},  {U'Ӹ', U'Ӽ'},  
+    {U'ԃ', U'Ԅ'},    {U'ԇ', U'ԍ'},  {U'Ԑ', U'Ԝ'},  {U'Ԟ', U'Ԣ'},  
+    {U'԰', U'Ա'},    {U'Ե', U'Զ'},  {U'Կ', U'Յ'},  {U'Վ', U'Ք'},  
+    {U'՘', U'՛'},    {U'՝', U'՝'},  {U'ՠ', U'զ'},  {U'ո', U'ջ'},  
+    {U'֏', U'֑'},    {U'֕', U'֞'},  {U'֥', U'֧'},  {U'ָ', U'־'},  
+    {U'ז', U'ח'},    {U'ך', U'נ'},  {U'פ', U'׭'},  {U'״', U'׺'},  
+    {U'-', U'0'},      {U'3', U'3'},    {U'I', U'P'},    {U'V', U'Z'},    
+    {U'|',  131},      { 143,  143},    { 151,  153},    {U'¤', U'©'},  
+    {U'²', U'³'},    {U'·', U'À'},  {U'È', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'ß'},  {U'ï', U'ï'},  {U'÷', U'÷'},  
+    {U'Ă', U'ą'},    {U'ė', U'Ĝ'},  {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  
+    {U'ī', U'ĳ'},    {U'ĵ', U'ĸ'},  {U'Ń', U'Ń'},  {U'ř', U'Ş'},  
+    {U'Ũ', U'ŭ'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'ƅ', U'ƈ'},    {U'Ɗ', U'Ǝ'},  {U'ƙ', U'Ɵ'},  {U'Ƣ', U'Ʃ'},  
+    {U'Ʋ', U'Ƹ'},    {U'Ƽ', U'ǂ'},  {U'Ǌ', U'ǎ'},  {U'Ǘ', U'Ǟ'},  
+    {U'ȉ', U'Ȏ'},    {U'Ȝ', U'ȡ'},  {U'ȫ', U'Ȭ'},  {U'ɀ', U'Ɂ'},  
+    {U'Ƀ', U'Ɉ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɘ', U'ɞ'},  
+    {U'ɢ', U'ɦ'},    {U'ɩ', U'ɩ'},  {U'ɫ', U'ɯ'},  {U'ɵ', U'ɶ'},  
+    {U'ɹ', U'ɽ'},    {U'ʁ', U'ʄ'},  {U'ʜ', U'ʡ'},  {U'ʭ', U'ʯ'},  
+    {U'ʳ', U'ʶ'},    {U'ʺ', U'ʼ'},  {U'ˁ', U'ˈ'},  {U'˛', U'ˠ'},  
+    {U'˯', U'˯'},    {U'˸', U'˼'},  {U'̎', U'̓'},  {U'̡', U'̦'},  
+    {U'̨', U'̨'},    {U'̬', U'̭'},  {U'̶', U'͆'},  {U'͊', U'͏'},  
+    {U'͒', U'͔'},    {U'͞', U'͢'},  {U'ͪ', U'ͭ'},  {U'Ͱ', U'Ͳ'},  
+    {U'ͷ', U'͸'},    {U'Ϳ', U'΄'},  {U'Ώ', U'Ώ'},  {U'Δ', U'Ζ'},  
+    {U'Ρ', U'Υ'},    {U'Ω', U'Ϊ'},  {U'ή', U'γ'},  {U'ε', U'κ'},  
+    {U'ξ', U'τ'},    {U'ύ', U'ϒ'},  {U'Ϩ', U'ϫ'},  {U'Ϯ', U'ϰ'},  
+    {U'϶', U'ϼ'},    {U'Њ', U'Ћ'},  {U'Ў', U'Џ'},  {U'П', U'У'},  
+    {U'Ч', U'Ю'},    {U'з', U'к'},  {U'ц', U'ђ'},  {U'є', U'є'},  
+    {U'ј', U'ќ'},    {U'҅', U'҅'},  {U'ҏ', U'ґ'},  {U'Ҥ', U'Ҭ'},  
+    {U'Ү', U'ҹ'},    {U'Ҽ', U'Ӂ'},  {U'ӣ', U'Ө'},  {U'ԇ', U'ԍ'},  
+    {U'Ԟ', U'Ԣ'},    {U'Ԧ', U'ԭ'},  {U'԰', U'Ա'},  {U'Է', U'Լ'},  
+    {U'Չ', U'Ք'},    {U'՝', U'՝'},  {U'ժ', U'ծ'},  {U'ո', U'ջ'},  
+    {U'վ', U'վ'},    {U'ւ', U'։'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֕', U'֘'},    {U'֢', U'֢'},  {U'֥', U'֧'},  {U'֪', U'ֱ'},  
+    {U'ֳ', U'ַ'},    {U'ֿ', U'ׁ'},  {U'׃', U'׆'},  {U'׊', U'א'},  
+    {U'ד', U'ה'},    {U'פ', U'ר'},  {U'׽', U'׽'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    113,  224,  329,  444,  554,  665,  780,  
+    899
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113511,  589,  543,  592,  591,  586,  592,  565
+};
+
+} // namespace synthetic_table_256
+
@@ -0,0 +1,126 @@
+#include "synthetic_table_64.h"
+
+namespace synthetic_table_64{
+extern const Segment_with_value<uint16_t, Categories_set> categories_table[] = {
+    {{U'ā', U'ā'}, 0xA1},  {{ 155,  158}, 0x1B},    {{U'ŗ', U'Ř'}, 0xBD},  
+    {{U'Z', U'a'}, 0x38},    {{U'Ë', U'Ð'}, 0x12},  {{U'Ĳ', U'ĸ'}, 0x16},  
+    {{U'ž', U'Ɓ'}, 0x37},  {{U'>', U'D'}, 0x8E},    {{U'|',  130}, 0xAD},    
+    {{U'³', U'·'}, 0x2D},  {{U'î', U'ï'}, 0xAB},  {{U'ė', U'Ĝ'}, 0x51},  
+    {{U'Ň', U'Ŋ'}, 0x24},  {{U'š', U'ŧ'}, 0xEF},  {{U'Ɛ', U'Ɛ'}, 0x51},  
+    {{U'0', U'3'},  0xB},    {{U'I', U'O'}, 0xE3},    {{U'j', U'q'}, 0x4C},    
+    {{ 140,  145}, 0xA5},    {{U'§', U'ª'}, 0x2E},  {{U'¾', U'À'}, 0xD0},  
+    {{U'Ý', U'ä'}, 0xFE},  {{U'û', U'û'}, 0xE8},  {{U'Č', U'Đ'}, 0x46},  
+    {{U'ģ', U'ĩ'}, 0x4D},  {{U'ŀ', U'ń'}, 0xB2},  {{U'Œ', U'Œ'}, 0x55},  
+    {{U'Ś', U'Ŝ'}, 0x8E},  {{U'ų', U'ŷ'}, 0x70},  {{U'Ɔ', U'ƍ'},  0xB},  
+    {{U'Ɣ', U'Ɩ'}, 0x43},  {{U')', U'/'}, 0x4A},    {{U'4', U';'}, 0x64},    
+    {{U'E', U'G'}, 0xC1},    {{U'R', U'X'}, 0x6C},    {{U'e', U'i'}, 0x3B},    
+    {{U't', U'y'}, 0x37},    {{ 131,  137}, 0x7A},    {{ 146,  152}, 0xA4},    
+    {{U' ', U'£'}, 0xF3},  {{U'«', U'²'}, 0x79},  {{U'º', U'½'}, 0x14},  
+    {{U'Â', U'Ç'}, 0x58},  {{U'Ó', U'Ú'}, 0xCA},  {{U'è', U'í'}, 0xF7},  
+    {{U'ò', U'ù'}, 0xBC},  {{U'ü', U'Ā'}, 0x1E},  {{U'Ą', U'Ĉ'}, 0xE5},  
+    {{U'Ĕ', U'Ĕ'}, 0xEF},  {{U'Ğ', U'ğ'}, 0xD0},  {{U'ī', U'İ'}, 0x75},  
+    {{U'ļ', U'Ŀ'}, 0x71},  {{U'ņ', U'ņ'}, 0x18},  {{U'Ō', U'Ő'}, 0x6D},  
+    {{U'Ŕ', U'Ŗ'}, 0x43},  {{U'ř', U'ř'}, 0xE8},  {{U'ş', U'Š'}, 0x3C},  
+    {{U'ū', U'ů'}, 0xED},  {{U'Ź', U'Ž'}, 0x40},  {{U'ƅ', U'ƅ'}, 0x83},  
+    {{U'Ǝ', U'Ǝ'}, 0x1B},  {{U'Ɠ', U'Ɠ'}, 0x17},  {{U'Ɨ', U'ƞ'}, 0xD4},  
+    {{  32, U'&'}, 0x8F}
+};
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x1,  
+    0x1,  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
+    0xB,  0xB,  0xB,  0xB,  0x64, 0x64, 0x64, 0x64, 
+    0x64, 0x64, 0x64, 0x64, 0x1,  0x1,  0x8E, 0x8E, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xC1, 0xC1, 0xC1, 
+    0x1,  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
+    0x1,  0x1,  0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 
+    0x6C, 0x1,  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
+    0x38, 0x38, 0x1,  0x1,  0x1,  0x3B, 0x3B, 0x3B, 
+    0x3B, 0x3B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
+    0x4C, 0x4C, 0x1,  0x1,  0x37, 0x37, 0x37, 0x37, 
+    0x37, 0x37, 0x1,  0x1,  0xAD, 0xAD, 0xAD, 0xAD
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x2F, 0x2F, 0xCF, 0xCF, 0xC7, 0xD7, 0xD7, 0xD7, 0xD7, 0xF3, 0x93, 0x93, 0x9B, 0x9B, 0x93, 0x93, 
+    0x1C, 0x1C, 0x1C, 0x1C, 0x94, 0xC4, 0xC4, 0xC0, 0xC0, 0xD4, 0x14, 0x14, 0x14, 0x14, 0x1C, 0x1C, 
+    0x94, 0x94, 0x34, 0x34, 0xBC, 0xAC, 0xAC, 0xA8, 0xA8, 0x88, 0x48, 0x48, 0xC0, 0xC0, 0xC8, 0xC8, 
+    0xDC, 0xDC, 0x3C, 0x3C, 0x34, 0x64, 0x64, 0x60, 0x60, 0x44, 0x64, 0x64, 0xE4, 0xE4, 0xEC, 0xEC, 
+    0x40, 0x40, 0x0,  0x0,  0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x40, 0x40, 0x20, 0x20, 0xA8, 0xE8, 0xE8, 0xE8, 0xE8, 0xD8, 0x38, 0x38, 0xB0, 0xB0, 0xB0, 0xB0, 
+    0x80, 0x80, 0x20, 0x20, 0x28, 0x38, 0x38, 0x38, 0x28, 0x1C, 0x5C, 0x5C, 0x54, 0x54, 0x54, 0x54, 
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x0,  0x10, 0x10, 0x10, 0x90, 0x90, 0x98, 0x98
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'('},    {U'0', U'3'},    {U'<', U'='},      {U'E', U'Q'},    
+    {U'Y', U'Y'},    {U'b', U'i'},    {U'r',  130},      { 138,  145},    
+    { 153, U'¦'},   {U'«', U'¹'},  {U'Á', U'Á'},    {U'È', U'Ê'},  
+    {U'Ñ', U'Ò'},  {U'Û', U'Ü'},  {U'å', U'ñ'},    {U'ú', U'ú'},  
+    {U'ā', U'ċ'},  {U'đ', U'ĝ'},  {U'Ġ', U'ı'},    {U'Ĺ', U'Ŀ'},  
+    {U'Ņ', U'Ņ'},  {U'ŋ', U'Ř'},  {U'ŝ', U'Ş'},    {U'š', U'Ų'},  
+    {U'Ÿ', U'Ÿ'},  {U'ž', U'Ɩ'},  {U'Ɵ', 1114111},  {  32, U'&'},    
+    {U')', U'3'},    {U'>', U'D'},    {U'I', U'O'},      {U'e', U'i'},    
+    {U't', U'y'},    { 131,  137},    { 155,  158},      {U' ', U'£'},  
+    {U'§', U'ª'},  {U'Ë', U'Ð'},  {U'Ó', U'Ú'},    {U'Ý', U'ä'},  
+    {U'è', U'ï'},  {U'ü', U'Ā'},  {U'Č', U'Đ'},    {U'Ĕ', U'Ĕ'},  
+    {U'Ĳ', U'ĸ'},  {U'ŀ', U'ń'},  {U'Ŕ', U'Ŗ'},    {U'Ś', U'Ŝ'},  
+    {U'š', U'ŧ'},  {U'ž', U'Ɓ'},  {U'ƅ', U'Ǝ'},    {U'Ɠ', U'Ɩ'},  
+    {  32, U'&'},    {U'4', U';'},    {U'>', U'D'},      {U'R', U'X'},    
+    {U'j', U'q'},    {U't', U'y'},    {U'|',  130},      { 140,  152},    
+    {U'§', U'ª'},  {U'³', U'·'},  {U'º', U'½'},    {U'Ý', U'ä'},  
+    {U'è', U'í'},  {U'ò', U'ù'},  {U'ü', U'Ā'},    {U'Ą', U'Ĉ'},  
+    {U'Č', U'Đ'},  {U'Ĕ', U'Ĕ'},  {U'ģ', U'ĩ'},    {U'ī', U'İ'},  
+    {U'Ĳ', U'ĸ'},  {U'Ň', U'Ŋ'},  {U'Ō', U'Ő'},    {U'Œ', U'Œ'},  
+    {U'ŗ', U'Ř'},  {U'Ś', U'Ŝ'},  {U'ş', U'ŧ'},    {U'ū', U'ů'},  
+    {U'ž', U'Ɓ'},  {U'Ɠ', U'Ɠ'},  {U'Ɨ', U'ƞ'},    {  32, U'&'},    
+    {U')', U'3'},    {U'>', U'D'},    {U'R', U'X'},      {U'Z', U'a'},    
+    {U'e', U'q'},    {U'|',  137},    { 155,  158},      {U'§', U'·'},  
+    {U'Â', U'Ç'},  {U'Ó', U'Ú'},  {U'Ý', U'ä'},    {U'î', U'ï'},  
+    {U'ò', U'ù'},  {U'û', U'Ā'},  {U'Ĕ', U'Ĕ'},    {U'ģ', U'ĩ'},  
+    {U'ņ', U'ņ'},  {U'Ō', U'Ő'},  {U'ŗ', U'Ŝ'},    {U'ş', U'ŧ'},  
+    {U'ū', U'ů'},  {U'Ɔ', U'Ǝ'},  {U'Z', U'a'},      {U'e', U'i'},    
+    {U't', U'y'},    { 131,  137},    { 155,  158},      {U' ', U'£'},  
+    {U'«', U'²'},  {U'º', U'À'},  {U'Â', U'Ç'},    {U'Ë', U'Ð'},  
+    {U'Ý', U'ä'},  {U'è', U'í'},  {U'ò', U'ù'},    {U'ü', U'Ā'},  
+    {U'ė', U'Ĝ'},  {U'Ğ', U'ğ'},  {U'ī', U'İ'},    {U'Ĳ', U'ĸ'},  
+    {U'ļ', U'ń'},  {U'ņ', U'ņ'},  {U'Œ', U'Œ'},    {U'ŗ', U'Ř'},  
+    {U'ş', U'Š'},  {U'ų', U'ŷ'},  {U'ž', U'Ɓ'},    {U'Ǝ', U'Ǝ'},  
+    {U'Ɛ', U'Ɛ'},  {U'Ɠ', U'Ɠ'},  {U'Ɨ', U'ƞ'},    {U'4', U';'},    
+    {U'I', U'O'},    {U'R', U'X'},    {U'Z', U'a'},      {U'e', U'i'},    
+    {U't', U'y'},    {U'|',  137},    { 140,  152},      {U' ', U'£'},  
+    {U'§', U'·'},  {U'Ý', U'ä'},  {U'è', U'ï'},    {U'ò', U'ù'},  
+    {U'û', U'û'},  {U'ā', U'ā'},  {U'Ą', U'Ĉ'},    {U'Ĕ', U'Ĕ'},  
+    {U'ī', U'İ'},  {U'ļ', U'ń'},  {U'Ň', U'Ŋ'},    {U'Ō', U'Ő'},  
+    {U'ŗ', U'ř'},  {U'ş', U'ŧ'},  {U'ū', U'ů'},    {U'ų', U'ŷ'},  
+    {U'ž', U'Ɓ'},  {U')', U'/'},    {U'4', U';'},      {U'E', U'G'},    
+    {U'I', U'O'},    {U'R', U'X'},    {U'j', U'q'},      { 131,  137},    
+    {U' ', U'£'},  {U'«', U'²'},  {U'¾', U'À'},    {U'Â', U'Ç'},  
+    {U'Ó', U'Ú'},  {U'Ý', U'ä'},  {U'è', U'í'},    {U'û', U'û'},  
+    {U'Ą', U'Ĉ'},  {U'Č', U'Đ'},  {U'Ĕ', U'Ĕ'},    {U'ė', U'Ĝ'},  
+    {U'Ğ', U'ğ'},  {U'ģ', U'ĩ'},  {U'ī', U'İ'},    {U'ļ', U'Ŀ'},  
+    {U'Ō', U'Ő'},  {U'Œ', U'Œ'},  {U'Ŕ', U'Ŗ'},    {U'ř', U'ř'},  
+    {U'š', U'ŧ'},  {U'ū', U'ů'},  {U'ų', U'ŷ'},    {U'Ź', U'Ž'},  
+    {U'Ɛ', U'Ɛ'},  {U'Ɣ', U'ƞ'},  {  32, U'&'},      {U'>', U'G'},    
+    {U'I', U'O'},    {U'|',  130},    { 140,  152},      {U' ', U'£'},  
+    {U'¾', U'À'},  {U'Ó', U'Ú'},  {U'Ý', U'ä'},    {U'è', U'ï'},  
+    {U'ò', U'ù'},  {U'û', U'û'},  {U'ā', U'ā'},    {U'Ą', U'Ĉ'},  
+    {U'Ĕ', U'Ĕ'},  {U'Ğ', U'ğ'},  {U'ŀ', U'ń'},    {U'ŗ', U'Ŝ'},  
+    {U'š', U'ŧ'},  {U'ū', U'ů'},  {U'ƅ', U'ƅ'},    {U'Ɨ', U'ƞ'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    27,  52,  83,  106,  135,  161,  194,  
+    216
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113952,  146,  176,  169,  144,  171,  171,  125
+};
+
+} // namespace synthetic_table_64
+
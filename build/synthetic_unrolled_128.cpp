@@ -0,0 +1,1059 @@
+#include "synthetic_unrolled_128.h"
+
+namespace synthetic_unrolled_128{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'Ƶ'){
+        if(c < U'é'){
+            if(c <  129){
+                if(c < U'S'){
+                    if(c < U'8'){
+                        if(c < U'('){
+                            if(c < U'"'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'&'){
+                                    return 0xFC;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'2'){
+                                if(c < U'0'){
+                                    return 0x95;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'7'){
+                                    return 0xC6;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'@'){
+                            if(c < U'<'){
+                                return 0x5A;
+                            }else{
+                                if(c < U'='){
+                                    return 0x6C;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'G'){
+                                if(c < U'F'){
+                                    return 0x6D;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'N'){
+                                    return 0xC0;
+                                }else{
+                                    return 0xD9;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'c'){
+                        if(c < U'Z'){
+                            if(c < U'U'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'Y'){
+                                    return 0xCC;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'_'){
+                                if(c < U']'){
+                                    return 0xB9;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'`'){
+                                    return 0x71;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'o'){
+                            if(c < U'k'){
+                                return 0x84;
+                            }else{
+                                if(c < U'n'){
+                                    return 0xBB;
+                                }else{
+                                    return 0xDA;
+                                }
+                            }
+                        }else{
+                            if(c < U'y'){
+                                if(c < U'r'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x76;
+                                }
+                            }else{
+                                if(c < U'~'){
+                                    return 0x22;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'µ'){
+                    if(c <  151){
+                        if(c <  139){
+                            if(c <  130){
+                                return 0xE3;
+                            }else{
+                                if(c <  131){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xB3;
+                                }
+                            }
+                        }else{
+                            if(c <  144){
+                                if(c <  143){
+                                    return 0x39;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c <  149){
+                                    return 0xE7;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c <  158){
+                            if(c <  154){
+                                return 0xA5;
+                            }else{
+                                if(c <  156){
+                                    return 0x77;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'¥'){
+                                if(c < U'¢'){
+                                    return 0x88;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'­'){
+                                    return 0x95;
+                                }else{
+                                    return 0xCA;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Î'){
+                        if(c < U'Å'){
+                            if(c < U'·'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'½'){
+                                    return 0xAD;
+                                }else{
+                                    return 0x37;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ì'){
+                                if(c < U'Ç'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xF5;
+                                }
+                            }else{
+                                if(c < U'Í'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x2A;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Õ'){
+                            if(c < U'Ñ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'Ô'){
+                                    return 0x81;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ý'){
+                                if(c < U'Ü'){
+                                    return 0xA;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'á'){
+                                    return 0x1A;
+                                }else{
+                                    return 0xB1;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'ť'){
+                if(c < U'Ĭ'){
+                    if(c < U'č'){
+                        if(c < U'õ'){
+                            if(c < U'ì'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ò'){
+                                    return 0x9F;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ÿ'){
+                                if(c < U'ý'){
+                                    return 0x1E;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'ą'){
+                                    return 0x53;
+                                }else{
+                                    return 0x48;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ĝ'){
+                            if(c < U'ĕ'){
+                                return 0x50;
+                            }else{
+                                if(c < U'Ė'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xC6;
+                                }
+                            }
+                        }else{
+                            if(c < U'ģ'){
+                                if(c < U'ĝ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xCC;
+                                }
+                            }else{
+                                if(c < U'Ĥ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x97;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ŉ'){
+                        if(c < U'Ľ'){
+                            if(c < U'ĳ'){
+                                return 0x79;
+                            }else{
+                                if(c < U'Ķ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x77;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ņ'){
+                                if(c < U'Ń'){
+                                    return 0x85;
+                                }else{
+                                    return 0x91;
+                                }
+                            }else{
+                                if(c < U'ň'){
+                                    return 0xD6;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ś'){
+                            if(c < U'Ő'){
+                                return 0x33;
+                            }else{
+                                if(c < U'œ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xEF;
+                                }
+                            }
+                        }else{
+                            if(c < U'ş'){
+                                if(c < U'Ş'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x1E;
+                                }
+                            }else{
+                                if(c < U'š'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xDB;
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'Ƌ'){
+                    if(c < U'ŷ'){
+                        if(c < U'Ŭ'){
+                            if(c < U'ŧ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ũ'){
+                                    return 0xB6;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ŵ'){
+                                if(c < U'Ů'){
+                                    return 0xFD;
+                                }else{
+                                    return 0x79;
+                                }
+                            }else{
+                                if(c < U'Ŷ'){
+                                    return 0x98;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ž'){
+                            if(c < U'Ź'){
+                                return 0xD3;
+                            }else{
+                                if(c < U'ż'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xE1;
+                                }
+                            }
+                        }else{
+                            if(c < U'ƃ'){
+                                if(c < U'ƀ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x10;
+                                }
+                            }else{
+                                if(c < U'Ƅ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x78;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Ƣ'){
+                        if(c < U'Ɩ'){
+                            if(c < U'ƌ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'Ɣ'){
+                                    return 0x75;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ƚ'){
+                                if(c < U'ƙ'){
+                                    return 0xD8;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ɵ'){
+                                    return 0xEE;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ƨ'){
+                            if(c < U'ƥ'){
+                                return 0x7A;
+                            }else{
+                                if(c < U'Ƨ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x99;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ʈ'){
+                                if(c < U'ƫ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x4;
+                                }
+                            }else{
+                                if(c < U'ư'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x4D;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'ɤ'){
+            if(c < U'Ȕ'){
+                if(c < U'ǩ'){
+                    if(c < U'ǎ'){
+                        if(c < U'ƽ'){
+                            if(c < U'Ʒ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ƺ'){
+                                    return 0xF2;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ǉ'){
+                                if(c < U'ǅ'){
+                                    return 0xE7;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ǌ'){
+                                    return 0xEF;
+                                }else{
+                                    return 0xCE;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ǘ'){
+                            if(c < U'Ǒ'){
+                                return 0x95;
+                            }else{
+                                if(c < U'ǒ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x24;
+                                }
+                            }
+                        }else{
+                            if(c < U'ǟ'){
+                                if(c < U'ǚ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xC0;
+                                }
+                            }else{
+                                if(c < U'Ǣ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x80;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ǽ'){
+                        if(c < U'Ǳ'){
+                            if(c < U'Ǭ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ǰ'){
+                                    return 0x9;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ƿ'){
+                                if(c < U'ǵ'){
+                                    return 0xF2;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ǻ'){
+                                    return 0xE5;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ȋ'){
+                            if(c < U'Ȃ'){
+                                return 0xEE;
+                            }else{
+                                if(c < U'ȉ'){
+                                    return 0x2B;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ȑ'){
+                                if(c < U'Ȏ'){
+                                    return 0xF;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ȓ'){
+                                    return 0xF1;
+                                }else{
+                                    return 0x4E;
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'Ȼ'){
+                    if(c < U'Ȫ'){
+                        if(c < U'ȝ'){
+                            if(c < U'Ȗ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'Ț'){
+                                    return 0x57;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ȡ'){
+                                if(c < U'ȟ'){
+                                    return 0x11;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ȩ'){
+                                    return 0xD9;
+                                }else{
+                                    return 0xDC;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ȳ'){
+                            if(c < U'ȭ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'Ȱ'){
+                                    return 0xFD;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ȵ'){
+                                if(c < U'ȳ'){
+                                    return 0xF6;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ⱥ'){
+                                    return 0x9B;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ɑ'){
+                        if(c < U'Ʉ'){
+                            if(c < U'ɀ'){
+                                return 0x68;
+                            }else{
+                                if(c < U'Ƀ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x83;
+                                }
+                            }
+                        }else{
+                            if(c < U'Ɉ'){
+                                if(c < U'Ɇ'){
+                                    return 0xFA;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'Ɏ'){
+                                    return 0x11;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ɗ'){
+                            if(c < U'ɒ'){
+                                return 0x1E;
+                            }else{
+                                if(c < U'ɔ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x58;
+                                }
+                            }
+                        }else{
+                            if(c < U'ɚ'){
+                                if(c < U'ə'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xA0;
+                                }
+                            }else{
+                                if(c < U'ɜ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x55;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'ʽ'){
+                if(c < U'ʒ'){
+                    if(c < U'ɼ'){
+                        if(c < U'ɰ'){
+                            if(c < U'ɫ'){
+                                return 0x6A;
+                            }else{
+                                if(c < U'ɮ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xDB;
+                                }
+                            }
+                        }else{
+                            if(c < U'ɸ'){
+                                if(c < U'ɱ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x23;
+                                }
+                            }else{
+                                if(c < U'ɺ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x24;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ʅ'){
+                            if(c < U'ɿ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ʄ'){
+                                    return 0x76;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ʐ'){
+                                if(c < U'ʋ'){
+                                    return 0x7;
+                                }else{
+                                    return 0x4D;
+                                }
+                            }else{
+                                if(c < U'ʑ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xB6;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ʪ'){
+                        if(c < U'ʚ'){
+                            if(c < U'ʔ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ʘ'){
+                                    return 0x42;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ʠ'){
+                                if(c < U'ʟ'){
+                                    return 0x39;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'ʤ'){
+                                    return 0x57;
+                                }else{
+                                    return 0xEF;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ʰ'){
+                            if(c < U'ʬ'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'ʮ'){
+                                    return 0xE7;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'ʷ'){
+                                if(c < U'ʲ'){
+                                    return 0x96;
+                                }else{
+                                    return 0x50;
+                                }
+                            }else{
+                                if(c < U'ʻ'){
+                                    return 0x2F;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'˴'){
+                    if(c < U'˜'){
+                        if(c < U'ˎ'){
+                            if(c < U'˅'){
+                                return 0x44;
+                            }else{
+                                if(c < U'ˌ'){
+                                    return 0x53;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'˖'){
+                                if(c < U'˕'){
+                                    return 0x3C;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'˚'){
+                                    return 0x5D;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'˦'){
+                            if(c < U'ˡ'){
+                                return 0x26;
+                            }else{
+                                if(c < U'ˣ'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x17;
+                                }
+                            }
+                        }else{
+                            if(c < U'˰'){
+                                if(c < U'˪'){
+                                    return 0xA5;
+                                }else{
+                                    return 0x27;
+                                }
+                            }else{
+                                if(c < U'˳'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x14;
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'̇'){
+                        if(c < U'˺'){
+                            if(c < U'˶'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'˷'){
+                                    return 0x67;
+                                }else{
+                                    return 0x8;
+                                }
+                            }
+                        }else{
+                            if(c < U'˽'){
+                                if(c < U'˻'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0xAB;
+                                }
+                            }else{
+                                if(c < U'̀'){
+                                    return default_categories_set;
+                                }else{
+                                    return 0x29;
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'̌'){
+                            if(c < U'̊'){
+                                return default_categories_set;
+                            }else{
+                                if(c < U'̋'){
+                                    return 0x7A;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }else{
+                            if(c < U'̑'){
+                                if(c < U'̎'){
+                                    return 0xE6;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }else{
+                                if(c < U'̘'){
+                                    return 0xF8;
+                                }else{
+                                    return default_categories_set;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0xFC, 0xFC, 0xFC, 0xFC, 0x1,  0x1,  
+    0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 
+    0x1,  0x1,  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x1,  
+    0x5A, 0x5A, 0x5A, 0x5A, 0x6C, 0x1,  0x1,  0x1,  
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x1,  0xC0, 
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xD9, 0xD9, 
+    0xD9, 0xD9, 0xD9, 0x1,  0x1,  0xCC, 0xCC, 0xCC, 
+    0xCC, 0x1,  0xB9, 0xB9, 0xB9, 0x1,  0x1,  0x71, 
+    0x1,  0x1,  0x1,  0x84, 0x84, 0x84, 0x84, 0x84, 
+    0x84, 0x84, 0x84, 0xBB, 0xBB, 0xBB, 0xDA, 0x1,  
+    0x1,  0x1,  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 
+    0x76, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1,  0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0xFF, 0xFF, 0x73, 0x33, 0x33, 0x13, 0x17, 0xF,  0x7,  0x27, 0x27, 0x67, 0x67, 0x6F, 0xBF, 0xFF, 
+    0x0,  0x0,  0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x88, 0x88, 0x88, 0xC8, 0xC0, 0xC0, 0x40, 0x0,  
+    0x10, 0x10, 0x9C, 0xDC, 0xDC, 0xFC, 0xE8, 0xE0, 0xE4, 0x44, 0x44, 0x4,  0xC,  0x4,  0x4,  0x4,  
+    0x30, 0x30, 0x34, 0x14, 0x14, 0x34, 0x20, 0x20, 0x28, 0x8,  0x28, 0x68, 0x68, 0x40, 0x50, 0x10, 
+    0x20, 0x20, 0xA4, 0x84, 0x84, 0x84, 0x80, 0x80, 0x8C, 0xC,  0x2C, 0x6C, 0x64, 0x44, 0x54, 0x34, 
+    0x10, 0x10, 0x94, 0x94, 0x94, 0x94, 0x80, 0x80, 0x80, 0x80, 0xA0, 0xE0, 0xE8, 0xC0, 0x0,  0x20, 
+    0x30, 0x30, 0xBC, 0x9C, 0x9C, 0xBC, 0xA8, 0xB0, 0xB8, 0x18, 0x18, 0x18, 0x18, 0x10, 0x50, 0x30, 
+    0x20, 0x20, 0x2C, 0x4C, 0x4C, 0x6C, 0x68, 0x70, 0x74, 0x54, 0x74, 0x74, 0x74, 0x54, 0x54, 0x14
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'!'},      {U'&', U'1'},    {U'7', U'7'},    {U'=', U'F'},    
+    {U'N', U'T'},      {U'Y', U'b'},    {U'k', U'm'},    {U'o', U'q'},    
+    {U'~',  157},      {U'¢', U'¬'},  {U'µ', U'Ì'},  {U'Î', U'Ô'},  
+    {U'Ü', U'Ü'},    {U'á', U'ô'},  {U'ý', U'Ą'},  {U'ĕ', U'ĕ'},  
+    {U'Ĝ', U'Ĝ'},    {U'ģ', U'ń'},  {U'ň', U'ŝ'},  {U'ş', U'Ŧ'},  
+    {U'ũ', U'ų'},    {U'Ŷ', U'ſ'},  {U'ƃ', U'ƃ'},  {U'Ƌ', U'ƕ'},  
+    {U'ƙ', U'ƙ'},    {U'Ɵ', U'ơ'},  {U'ƥ', U'ƪ'},  {U'Ʈ', U'ƶ'},  
+    {U'ƺ', U'ǉ'},    {U'ǎ', U'Ǒ'},  {U'Ǘ', U'Ǚ'},  {U'ǟ', U'ǡ'},  
+    {U'ǩ', U'ǰ'},    {U'ǵ', U'Ǽ'},  {U'Ȃ', U'ȑ'},  {U'Ȕ', U'ȧ'},  
+    {U'Ȫ', U'ȱ'},    {U'ȳ', U'Ⱥ'},  {U'ɀ', U'Ƀ'},  {U'Ɇ', U'ɐ'},  
+    {U'ɒ', U'ɓ'},    {U'ɗ', U'ɘ'},  {U'ɚ', U'ɣ'},  {U'ɫ', U'ɹ'},  
+    {U'ɼ', U'ɾ'},    {U'ʄ', U'ʐ'},  {U'ʒ', U'ʓ'},  {U'ʘ', U'ʯ'},  
+    {U'ʷ', U'ʼ'},    {U'˅', U'ˍ'},  {U'˕', U'˛'},  {U'ˡ', U'˲'},  
+    {U'˴', U'˶'},    {U'˺', U'̉'},  {U'̋', U'̋'},  {U'̎', U'̐'},  
+    {U'̘', 1114111},  {U'2', U'6'},    {U'8', U';'},    {U'k', U'n'},    
+    {U'r', U'}'},      { 129,  129},    { 131,  138},    { 144,  148},    
+    { 154,  155},      {U'­', U'´'},  {U'½', U'Ä'},  {U'Í', U'Í'},  
+    {U'Õ', U'Û'},    {U'Ý', U'à'},  {U'ì', U'ñ'},  {U'õ', U'ü'},  
+    {U'ÿ', U'Ą'},    {U'Ė', U'ě'},  {U'Ĥ', U'ī'},  {U'Ķ', U'ļ'},  
+    {U'Ņ', U'Ň'},    {U'ŉ', U'ŏ'},  {U'œ', U'Ś'},  {U'Ş', U'Ş'},  
+    {U'š', U'Ť'},    {U'ŧ', U'Ũ'},  {U'ŷ', U'Ÿ'},  {U'ƚ', U'ƞ'},  
+    {U'Ƣ', U'Ƥ'},    {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  {U'Ǉ', U'Ǎ'},  
+    {U'Ǳ', U'Ǵ'},    {U'ǽ', U'Ȉ'},  {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  
+    {U'Ȗ', U'ș'},    {U'Ȳ', U'Ȳ'},  {U'ȵ', U'ȹ'},  {U'Ƀ', U'Ʌ'},  
+    {U'ɑ', U'ɑ'},    {U'ɤ', U'ɪ'},  {U'ɮ', U'ɯ'},  {U'ɱ', U'ɷ'},  
+    {U'ɿ', U'ʃ'},    {U'ʅ', U'ʊ'},  {U'ʑ', U'ʑ'},  {U'ʔ', U'ʗ'},  
+    {U'ʠ', U'ʩ'},    {U'ʬ', U'ʭ'},  {U'ʰ', U'ʱ'},  {U'ʷ', U'ʺ'},  
+    {U'˅', U'ˋ'},    {U'˜', U'ˠ'},  {U'ˣ', U'˥'},  {U'˪', U'˯'},  
+    {U'˶', U'˶'},    {U'˻', U'˼'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'"', U'%'},      {U'(', U'/'},    {U'2', U'6'},    {U'<', U'<'},    
+    {U'@', U'E'},      {U'U', U'X'},    {U'c', U'j'},    {U'r', U'x'},    
+    { 144,  148},      { 151,  155},    {U'¥', U'¬'},  {U'·', U'Ä'},  
+    {U'Ç', U'Ë'},    {U'ì', U'ñ'},  {U'õ', U'ü'},  {U'Ė', U'ě'},  
+    {U'ĝ', U'Ģ'},    {U'Ĥ', U'ī'},  {U'Ķ', U'ł'},  {U'Ņ', U'Ň'},  
+    {U'œ', U'Ś'},    {U'Ş', U'Ş'},  {U'ŧ', U'Ũ'},  {U'Ŭ', U'ŭ'},  
+    {U'ƌ', U'Ɠ'},    {U'ƚ', U'ƞ'},  {U'ƫ', U'ƭ'},  {U'ư', U'ƴ'},  
+    {U'ƽ', U'Ǆ'},    {U'Ǉ', U'ǐ'},  {U'ǒ', U'ǖ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'ȁ'},    {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  {U'Ȗ', U'ș'},  
+    {U'Ȩ', U'ȩ'},    {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  {U'ɑ', U'ɑ'},  
+    {U'ɜ', U'ɣ'},    {U'ɺ', U'ɻ'},  {U'ɿ', U'ʃ'},  {U'ʅ', U'ʏ'},  
+    {U'ʑ', U'ʑ'},    {U'ʠ', U'ʩ'},  {U'ʬ', U'ʭ'},  {U'ʰ', U'ʱ'},  
+    {U'ʷ', U'ʺ'},    {U'ʽ', U'˄'},  {U'ˎ', U'˔'},  {U'˖', U'˙'},  
+    {U'˜', U'ˠ'},    {U'ˣ', U'˯'},  {U'˳', U'˳'},  {U'˶', U'˶'},  
+    {U'̌', U'̍'},    {U'"', U'%'},    {U'8', U'<'},    {U'@', U'E'},    
+    {U'N', U'R'},      {U'U', U'X'},    {U'Z', U'\\'},   {U'k', U'n'},    
+    { 139,  142},      { 158, U'¡'},   {U'­', U'´'},  {U'·', U'¼'},  
+    {U'Í', U'Í'},    {U'Õ', U'Û'},  {U'Ý', U'à'},  {U'ì', U'ñ'},  
+    {U'õ', U'ü'},    {U'ą', U'Č'},  {U'ĝ', U'Ģ'},  {U'Ĭ', U'Ĳ'},  
+    {U'œ', U'Ś'},    {U'Ş', U'Ş'},  {U'š', U'Ť'},  {U'Ŭ', U'ŵ'},  
+    {U'Ƅ', U'Ɗ'},    {U'Ɩ', U'Ƙ'},  {U'ƚ', U'ƞ'},  {U'Ƣ', U'Ƥ'},  
+    {U'Ƨ', U'Ƨ'},    {U'ư', U'ƴ'},  {U'Ǉ', U'Ǎ'},  {U'Ǭ', U'ǯ'},  
+    {U'ǽ', U'Ȉ'},    {U'ȋ', U'ȍ'},  {U'Ȓ', U'ȓ'},  {U'ȡ', U'ȩ'},  
+    {U'ȭ', U'ȯ'},    {U'ȵ', U'ȹ'},  {U'Ȼ', U'ȿ'},  {U'Ʉ', U'Ʌ'},  
+    {U'ɑ', U'ɑ'},    {U'ɔ', U'ɖ'},  {U'ɤ', U'ɪ'},  {U'ɮ', U'ɯ'},  
+    {U'ʋ', U'ʏ'},    {U'ʚ', U'ʞ'},  {U'ʤ', U'ʩ'},  {U'ʷ', U'ʺ'},  
+    {U'ˎ', U'˔'},    {U'˖', U'˙'},  {U'˷', U'˹'},  {U'˻', U'˼'},  
+    {U'̀', U'̆'},    {U'̊', U'̊'},  {U'̑', U'̗'},  {U'"', U'%'},    
+    {U'(', U'/'},      {U'8', U';'},    {U'N', U'R'},    {U'Z', U'\\'},   
+    {U'_', U'_'},      {U'k', U'n'},    {U'r', U'x'},    { 131,  142},    
+    { 154,  155},      {U'¥', U'¬'},  {U'½', U'Ä'},  {U'Ç', U'Ë'},  
+    {U'Ý', U'è'},    {U'ì', U'ñ'},  {U'õ', U'ü'},  {U'ÿ', U'Ą'},  
+    {U'č', U'Ĕ'},    {U'Ĥ', U'Ĳ'},  {U'Ķ', U'ļ'},  {U'Ń', U'Ň'},  
+    {U'ŉ', U'ŏ'},    {U'Ş', U'Ş'},  {U'š', U'Ť'},  {U'ŧ', U'Ũ'},  
+    {U'Ŭ', U'ŵ'},    {U'ŷ', U'Ÿ'},  {U'ƀ', U'Ƃ'},  {U'Ƅ', U'Ɗ'},  
+    {U'ƌ', U'Ɠ'},    {U'Ɩ', U'Ƙ'},  {U'Ƣ', U'Ƥ'},  {U'Ƨ', U'Ƨ'},  
+    {U'Ʒ', U'ƹ'},    {U'ǎ', U'ǐ'},  {U'Ǳ', U'Ǵ'},  {U'ȑ', U'ȑ'},  
+    {U'Ȗ', U'ș'},    {U'ȝ', U'Ȟ'},  {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  
+    {U'Ȳ', U'Ȳ'},    {U'ȵ', U'ȹ'},  {U'Ʉ', U'Ʌ'},  {U'Ɉ', U'ɍ'},  
+    {U'ɑ', U'ɑ'},    {U'ɔ', U'ɖ'},  {U'ɜ', U'ɣ'},  {U'ɮ', U'ɯ'},  
+    {U'ɿ', U'ʃ'},    {U'ʑ', U'ʑ'},  {U'ʚ', U'ʞ'},  {U'ʠ', U'ʣ'},  
+    {U'ʰ', U'ʶ'},    {U'˅', U'ˋ'},  {U'ˎ', U'˔'},  {U'˖', U'˙'},  
+    {U'ˣ', U'˥'},    {U'˳', U'˳'},  {U'̊', U'̊'},  {U'̑', U'̗'},  
+    {U'"', U'%'},      {U'<', U'<'},    {U'@', U'E'},    {U'Z', U'\\'},   
+    {U'_', U'_'},      {U'k', U'm'},    {U'r', U'}'},    { 129,  129},    
+    { 131,  142},      { 144,  148},    { 151,  155},    {U'·', U'Ä'},  
+    {U'Ç', U'Ë'},    {U'Í', U'Í'},  {U'á', U'è'},  {U'Ĭ', U'Ĳ'},  
+    {U'Ķ', U'ļ'},    {U'ŉ', U'ŏ'},  {U'œ', U'Ś'},  {U'ŧ', U'Ũ'},  
+    {U'Ŭ', U'ų'},    {U'ż', U'Ž'},  {U'Ƅ', U'Ɗ'},  {U'ƌ', U'Ɠ'},  
+    {U'ƚ', U'ƞ'},    {U'Ƣ', U'Ƥ'},  {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  
+    {U'Ǉ', U'ǉ'},    {U'ǒ', U'ǖ'},  {U'Ǳ', U'Ǵ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'Ȉ'},    {U'ȑ', U'ȑ'},  {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  
+    {U'Ȼ', U'ȿ'},    {U'Ʉ', U'Ʌ'},  {U'ə', U'ə'},  {U'ɤ', U'ɪ'},  
+    {U'ɱ', U'ɷ'},    {U'ɺ', U'ɻ'},  {U'ɿ', U'ʃ'},  {U'ʑ', U'ʑ'},  
+    {U'ʚ', U'ʞ'},    {U'ʤ', U'ʩ'},  {U'ʬ', U'ʭ'},  {U'ʷ', U'ʺ'},  
+    {U'ˎ', U'˔'},    {U'˜', U'ˠ'},  {U'˦', U'˯'},  {U'˶', U'˶'},  
+    {U'˻', U'˼'},    {U'̀', U'̆'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'},    {U'"', U'%'},    {U'2', U'6'},    {U'8', U'<'},    
+    {U'@', U'E'},      {U'G', U'R'},    {U'U', U'X'},    {U'_', U'_'},    
+    {U'n', U'n'},      {U'r', U'x'},    { 129,  129},    { 144,  148},    
+    { 154,  155},      {U'­', U'´'},  {U'Ç', U'Ë'},  {U'ÿ', U'Ĕ'},  
+    {U'Ė', U'ě'},    {U'ĝ', U'Ģ'},  {U'Ĭ', U'Ĳ'},  {U'Ķ', U'ļ'},  
+    {U'Ņ', U'Ň'},    {U'œ', U'Ś'},  {U'š', U'Ť'},  {U'Ŭ', U'ų'},  
+    {U'ŷ', U'Ÿ'},    {U'ż', U'Ž'},  {U'Ƅ', U'Ɗ'},  {U'ƌ', U'Ɠ'},  
+    {U'Ɩ', U'Ƙ'},    {U'ƚ', U'ƞ'},  {U'Ƣ', U'Ƥ'},  {U'ư', U'ƴ'},  
+    {U'Ʒ', U'ƹ'},    {U'ƽ', U'Ǆ'},  {U'Ǉ', U'Ǎ'},  {U'ǚ', U'Ǟ'},  
+    {U'Ǳ', U'Ǵ'},    {U'Ƿ', U'ǹ'},  {U'ǽ', U'ȁ'},  {U'ȑ', U'ȓ'},  
+    {U'Ȗ', U'ș'},    {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  {U'Ȳ', U'Ȳ'},  
+    {U'Ȼ', U'ȿ'},    {U'Ʉ', U'Ʌ'},  {U'ɔ', U'ɖ'},  {U'ɜ', U'ɪ'},  
+    {U'ɮ', U'ɯ'},    {U'ɿ', U'ʃ'},  {U'ʋ', U'ʏ'},  {U'ʔ', U'ʗ'},  
+    {U'ʠ', U'ʩ'},    {U'ʬ', U'ʭ'},  {U'ʲ', U'ʶ'},  {U'ʽ', U'ˋ'},  
+    {U'˖', U'˙'},    {U'˶', U'˶'},  {U'̊', U'̊'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'},    {U'"', U'%'},    {U'(', U'/'},    {U'2', U'6'},    
+    {U'G', U'R'},      {U'U', U'X'},    {U'Z', U'\\'},   {U'c', U'n'},    
+    { 129,  129},      { 131,  138},    { 144,  148},    { 151,  153},    
+    { 158, U'¡'},     {U'¥', U'´'},  {U'·', U'¼'},  {U'Ç', U'Ë'},  
+    {U'Ñ', U'Ó'},    {U'á', U'è'},  {U'ì', U'ñ'},  {U'Ė', U'ě'},  
+    {U'ĝ', U'Ģ'},    {U'Ĥ', U'ī'},  {U'Ľ', U'Ň'},  {U'œ', U'Ś'},  
+    {U'š', U'Ť'},    {U'ŧ', U'Ũ'},  {U'Ŭ', U'ŭ'},  {U'Ŵ', U'ŵ'},  
+    {U'ŷ', U'Ÿ'},    {U'ż', U'Ž'},  {U'Ɩ', U'Ƙ'},  {U'ƚ', U'ƞ'},  
+    {U'Ƨ', U'Ƨ'},    {U'Ʒ', U'ƹ'},  {U'ƽ', U'Ǆ'},  {U'Ǉ', U'ǐ'},  
+    {U'ǚ', U'Ǟ'},    {U'Ǣ', U'Ǩ'},  {U'Ǳ', U'Ǵ'},  {U'Ƿ', U'ǹ'},  
+    {U'ǽ', U'ȁ'},    {U'ȑ', U'ȑ'},  {U'ȡ', U'ȩ'},  {U'ȭ', U'ȯ'},  
+    {U'Ȳ', U'Ȳ'},    {U'ȵ', U'ȹ'},  {U'Ƀ', U'Ʌ'},  {U'ə', U'ə'},  
+    {U'ɮ', U'ɯ'},    {U'ʑ', U'ʑ'},  {U'ʤ', U'ʩ'},  {U'ʬ', U'ʭ'},  
+    {U'ʰ', U'ʱ'},    {U'˦', U'˩'},  {U'˻', U'˼'},  {U'̌', U'̍'},  
+    {U'̑', U'̗'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    57,  116,  173,  227,  288,  345,  405,  
+    461
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113864,  275,  297,  263,  298,  277,  315,  271
+};
+
+} // namespace synthetic_unrolled_128
+
@@ -0,0 +1,156 @@
+#include "synthetic_unrolled_16.h"
+
+namespace synthetic_unrolled_16{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'J'){
+        if(c < U'3'){
+            if(c < U')'){
+                if(c < U'!'){
+                    return default_categories_set;
+                }else{
+                    if(c < U'('){
+                        return 0xF6;
+                    }else{
+                        return default_categories_set;
+                    }
+                }
+            }else{
+                if(c < U'+'){
+                    return 0x4F;
+                }else{
+                    if(c < U'1'){
+                        return 0xF;
+                    }else{
+                        return 0xC4;
+                    }
+                }
+            }
+        }else{
+            if(c < U'C'){
+                if(c < U':'){
+                    return 0xDA;
+                }else{
+                    if(c < U'<'){
+                        return default_categories_set;
+                    }else{
+                        return 0x31;
+                    }
+                }
+            }else{
+                if(c < U'D'){
+                    return 0x8C;
+                }else{
+                    if(c < U'G'){
+                        return default_categories_set;
+                    }else{
+                        return 0x53;
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'`'){
+            if(c < U'S'){
+                if(c < U'Q'){
+                    return 0x69;
+                }else{
+                    if(c < U'R'){
+                        return default_categories_set;
+                    }else{
+                        return 0x15;
+                    }
+                }
+            }else{
+                if(c < U'X'){
+                    return 0x8F;
+                }else{
+                    if(c < U'['){
+                        return default_categories_set;
+                    }else{
+                        return 0xFF;
+                    }
+                }
+            }
+        }else{
+            if(c < U'i'){
+                if(c < U'c'){
+                    return 0xB0;
+                }else{
+                    if(c < U'd'){
+                        return default_categories_set;
+                    }else{
+                        return 0x21;
+                    }
+                }
+            }else{
+                if(c < U'n'){
+                    return 0xB4;
+                }else{
+                    if(c < U'u'){
+                        return 0xC6;
+                    }else{
+                        return default_categories_set;
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 
+    0x1,  0x4F, 0x4F, 0xF,  0xF,  0xF,  0xF,  0xF,  
+    0xF,  0xC4, 0xC4, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 
+    0xDA, 0xDA, 0x1,  0x1,  0x31, 0x31, 0x31, 0x31, 
+    0x31, 0x31, 0x31, 0x8C, 0x1,  0x1,  0x1,  0x53, 
+    0x53, 0x53, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x1,  0x15, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 
+    0x1,  0x1,  0x1,  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xB0, 0xB0, 0xB0, 0x1,  0x21, 0x21, 0x21, 0x21, 
+    0x21, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC6, 0xC6, 
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x3F, 0x33, 0x33, 0x63, 0x73, 0xF3, 0xF3, 0xF3, 0xF7, 0xB7, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 
+    0x88, 0x84, 0x84, 0xAC, 0xAC, 0x2C, 0x2C, 0x3C, 0x18, 0x1C, 0x4,  0x24, 0x24, 0x24, 0x64, 0x64, 
+    0x88, 0x8C, 0xAC, 0xB4, 0xA4, 0x24, 0x24, 0x24, 0x0,  0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64, 
+    0x28, 0x0,  0x0,  0x38, 0x28, 0x28, 0x28, 0x28, 0x8,  0xC,  0x14, 0x34, 0x34, 0x34, 0x34, 0x34, 
+    0x50, 0x54, 0x74, 0xC,  0xC,  0xC,  0xC,  0x1C, 0x18, 0x58, 0x40, 0x60, 0x68, 0x68, 0x28, 0x28, 
+    0x70, 0x54, 0x54, 0x4,  0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x50, 0x70, 0x78, 0x78, 0x38, 0x38, 
+    0xA0, 0x8C, 0x8C, 0x8C, 0x8C, 0xC,  0xC,  0x1C, 0x18, 0x1C, 0x14, 0x30, 0x30, 0x30, 0x70, 0x70, 
+    0xC0, 0xCC, 0xCC, 0xBC, 0xAC, 0x2C, 0x2C, 0x2C, 0x8,  0x48, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0,   32},   {U'(', U'0'},     {U':', U'B'},   {U'D', U'_'},   
+    {U'c', U'h'},   {U'u', 1114111},  {U'!', U'\''},  {U')', U'0'},   
+    {U'3', U'9'},   {U'G', U'I'},     {U'S', U'W'},   {U'[', U'_'},   
+    {U'n', U't'},   {U'!', U'\''},    {U')', U'2'},   {U'C', U'C'},   
+    {U'R', U'W'},   {U'[', U'_'},     {U'i', U't'},   {U')', U'0'},   
+    {U'3', U'9'},   {U'C', U'C'},     {U'J', U'P'},   {U'S', U'W'},   
+    {U'[', U'_'},   {U'!', U'\''},    {U'3', U'9'},   {U'<', U'B'},   
+    {U'G', U'I'},   {U'R', U'R'},     {U'[', U'b'},   {U'i', U'm'},   
+    {U'!', U'\''},  {U'<', U'B'},     {U'J', U'P'},   {U'[', U'b'},   
+    {U'd', U'm'},   {U'!', U'\''},    {U')', U'*'},   {U'1', U'9'},   
+    {U'G', U'P'},   {U'[', U'_'},     {U'n', U't'},   {U'!', U'\''},  
+    {U'1', U'9'},   {U'C', U'C'},     {U'S', U'W'},   {U'[', U'b'},   
+    {U'i', U't'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   6,  13,  19,  25,  32,  37,  43,  
+    49
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114080,  42,  41,  33,  38,  39,  40,  42
+};
+
+} // namespace synthetic_unrolled_16
+
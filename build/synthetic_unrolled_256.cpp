@@ -0,0 +1,2032 @@
+#include "synthetic_unrolled_256.h"
+
+namespace synthetic_unrolled_256{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'̑'){
+        if(c < U'Ƅ'){
+            if(c < U'Ê'){
+                if(c < U'o'){
+                    if(c < U'G'){
+                        if(c < U'-'){
+                            if(c < U'$'){
+                                if(c <   32){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'#'){
+                                        return 0x4C;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'%'){
+                                    return 0x50;
+                                }else{
+                                    if(c < U'&'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x72;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'4'){
+                                if(c < U'1'){
+                                    return 0xCC;
+                                }else{
+                                    if(c < U'3'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x8B;
+                                    }
+                                }
+                            }else{
+                                if(c < U'='){
+                                    if(c < U';'){
+                                        return 0x51;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'D'){
+                                        return 0x18;
+                                    }else{
+                                        return 0x25;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'['){
+                            if(c < U'R'){
+                                if(c < U'I'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Q'){
+                                        return 0xE9;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'U'){
+                                    if(c < U'S'){
+                                        return 0x52;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'V'){
+                                        return 0x2A;
+                                    }else{
+                                        return 0xD4;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'g'){
+                                if(c < U'\\'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'`'){
+                                        return 0x1A;
+                                    }else{
+                                        return 0x33;
+                                    }
+                                }
+                            }else{
+                                if(c < U'j'){
+                                    if(c < U'i'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x1F;
+                                    }
+                                }else{
+                                    if(c < U'n'){
+                                        return 0x58;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c <  154){
+                        if(c <  139){
+                            if(c < U'|'){
+                                if(c < U'r'){
+                                    return 0x64;
+                                }else{
+                                    if(c < U'u'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x5F;
+                                    }
+                                }
+                            }else{
+                                if(c <  134){
+                                    if(c <  132){
+                                        return 0xDC;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c <  137){
+                                        return 0x26;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c <  144){
+                                if(c <  141){
+                                    return 0x44;
+                                }else{
+                                    if(c <  143){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xDB;
+                                    }
+                                }
+                            }else{
+                                if(c <  148){
+                                    if(c <  146){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xF;
+                                    }
+                                }else{
+                                    if(c <  151){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xFD;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'²'){
+                            if(c < U'¤'){
+                                if(c <  156){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'¡'){
+                                        return 0x1D;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'«'){
+                                    if(c < U'ª'){
+                                        return 0xB2;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'°'){
+                                        return 0x1E;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'¾'){
+                                if(c < U'´'){
+                                    return 0x95;
+                                }else{
+                                    if(c < U'·'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x8A;
+                                    }
+                                }
+                            }else{
+                                if(c < U'È'){
+                                    if(c < U'Á'){
+                                        return 0xDC;
+                                    }else{
+                                        return 0x5C;
+                                    }
+                                }else{
+                                    if(c < U'É'){
+                                        return 0x87;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'ħ'){
+                    if(c < U'ð'){
+                        if(c < U'à'){
+                            if(c < U'×'){
+                                if(c < U'Ñ'){
+                                    return 0xBF;
+                                }else{
+                                    if(c < U'Ô'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xFF;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ù'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ü'){
+                                        return 0xE5;
+                                    }else{
+                                        return 0xA2;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ä'){
+                                if(c < U'á'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ã'){
+                                        return 0x38;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ì'){
+                                    if(c < U'ç'){
+                                        return 0x33;
+                                    }else{
+                                        return 0x73;
+                                    }
+                                }else{
+                                    if(c < U'ï'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xCB;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ď'){
+                            if(c < U'ÿ'){
+                                if(c < U'÷'){
+                                    return 0x35;
+                                }else{
+                                    if(c < U'ø'){
+                                        return 0x86;
+                                    }else{
+                                        return 0x2E;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ć'){
+                                    if(c < U'Ă'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xEB;
+                                    }
+                                }else{
+                                    if(c < U'ĉ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xA;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ė'){
+                                if(c < U'đ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ė'){
+                                        return 0x47;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ġ'){
+                                    if(c < U'ĝ'){
+                                        return 0x85;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ĥ'){
+                                        return 0xFE;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ň'){
+                        if(c < U'ĺ'){
+                            if(c < U'ı'){
+                                if(c < U'Ī'){
+                                    return 0xD7;
+                                }else{
+                                    if(c < U'ī'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xF4;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ĵ'){
+                                    if(c < U'Ĵ'){
+                                        return 0xBC;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ĺ'){
+                                        return 0xDC;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Ń'){
+                                if(c < U'ľ'){
+                                    return 0x50;
+                                }else{
+                                    if(c < U'ŀ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x37;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ņ'){
+                                    if(c < U'ń'){
+                                        return 0xC8;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ň'){
+                                        return 0x5D;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ũ'){
+                            if(c < U'Ŗ'){
+                                if(c < U'Ŏ'){
+                                    return 0x50;
+                                }else{
+                                    if(c < U'œ'){
+                                        return 0x33;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ş'){
+                                    if(c < U'ř'){
+                                        return 0x3A;
+                                    }else{
+                                        return 0xF7;
+                                    }
+                                }else{
+                                    if(c < U'Š'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x24;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Ŵ'){
+                                if(c < U'Ů'){
+                                    return 0xD4;
+                                }else{
+                                    if(c < U'Ű'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x8E;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ż'){
+                                    if(c < U'Ŷ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xCF;
+                                    }
+                                }else{
+                                    if(c < U'ſ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xEB;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'ɑ'){
+                if(c < U'ǵ'){
+                    if(c < U'ƹ'){
+                        if(c < U'ƙ'){
+                            if(c < U'Ɗ'){
+                                if(c < U'ƅ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ɖ'){
+                                        return 0xB3;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ə'){
+                                    return 0xFD;
+                                }else{
+                                    if(c < U'ƒ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ƪ'){
+                                if(c < U'Ơ'){
+                                    return 0x88;
+                                }else{
+                                    if(c < U'Ƣ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB5;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ʋ'){
+                                    if(c < U'Ƭ'){
+                                        return 0x52;
+                                    }else{
+                                        return 0x2A;
+                                    }
+                                }else{
+                                    if(c < U'ƶ'){
+                                        return 0xEA;
+                                    }else{
+                                        return 0xB2;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ǒ'){
+                            if(c < U'ǆ'){
+                                if(c < U'Ƽ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ǃ'){
+                                        return 0xC5;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ǌ'){
+                                    if(c < U'ǉ'){
+                                        return 0x70;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ǐ'){
+                                        return 0xF8;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ǟ'){
+                                if(c < U'ǔ'){
+                                    return 0x46;
+                                }else{
+                                    if(c < U'Ǘ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xD8;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ǫ'){
+                                    if(c < U'Ǣ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x4C;
+                                    }
+                                }else{
+                                    if(c < U'ǭ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x4A;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ȩ'){
+                        if(c < U'ȉ'){
+                            if(c < U'ǽ'){
+                                if(c < U'Ƕ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ǻ'){
+                                        return 0x63;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ȁ'){
+                                    if(c < U'Ǿ'){
+                                        return 0x15;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ȇ'){
+                                        return 0x5;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Ț'){
+                                if(c < U'ȏ'){
+                                    return 0xD8;
+                                }else{
+                                    if(c < U'Ȓ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x44;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ȣ'){
+                                    if(c < U'Ȝ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x97;
+                                    }
+                                }else{
+                                    if(c < U'ȣ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x70;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ɀ'){
+                            if(c < U'Ȱ'){
+                                if(c < U'ȫ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ȭ'){
+                                        return 0xB9;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ȹ'){
+                                    if(c < U'ȳ'){
+                                        return 0x43;
+                                    }else{
+                                        return 0x1B;
+                                    }
+                                }else{
+                                    if(c < U'ȿ'){
+                                        return 0x41;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ɉ'){
+                                if(c < U'ɂ'){
+                                    return 0x83;
+                                }else{
+                                    if(c < U'Ƀ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB9;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ɍ'){
+                                    if(c < U'Ɋ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB7;
+                                    }
+                                }else{
+                                    if(c < U'Ɏ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB7;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'ʭ'){
+                    if(c < U'ɹ'){
+                        if(c < U'ɧ'){
+                            if(c < U'ɛ'){
+                                if(c < U'ɒ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ɘ'){
+                                        return 0x7B;
+                                    }else{
+                                        return 0xAA;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ɟ'){
+                                    return 0xA1;
+                                }else{
+                                    if(c < U'ɢ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xD9;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ɫ'){
+                                if(c < U'ɩ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ɪ'){
+                                        return 0xE6;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ɵ'){
+                                    if(c < U'ɰ'){
+                                        return 0xAB;
+                                    }else{
+                                        return 0x4F;
+                                    }
+                                }else{
+                                    if(c < U'ɷ'){
+                                        return 0xB7;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'ʕ'){
+                            if(c < U'ʅ'){
+                                if(c < U'ɾ'){
+                                    return 0xB3;
+                                }else{
+                                    if(c < U'ʁ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xE0;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ʊ'){
+                                    if(c < U'ʈ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x29;
+                                    }
+                                }else{
+                                    if(c < U'ʍ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x33;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ʜ'){
+                                if(c < U'ʗ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ʚ'){
+                                        return 0x59;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ʣ'){
+                                    if(c < U'ʢ'){
+                                        return 0xA9;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ʫ'){
+                                        return 0x12;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'˛'){
+                        if(c < U'ˁ'){
+                            if(c < U'ʷ'){
+                                if(c < U'ʰ'){
+                                    return 0x8F;
+                                }else{
+                                    if(c < U'ʳ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB3;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ʽ'){
+                                    if(c < U'ʺ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xEF;
+                                    }
+                                }else{
+                                    if(c < U'ʾ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x63;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'˒'){
+                                if(c < U'ˉ'){
+                                    return 0xB6;
+                                }else{
+                                    if(c < U'ˋ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x65;
+                                    }
+                                }
+                            }else{
+                                if(c < U'˖'){
+                                    if(c < U'˓'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x2E;
+                                    }
+                                }else{
+                                    if(c < U'˘'){
+                                        return 0x2A;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'˲'){
+                            if(c < U'˧'){
+                                if(c < U'ˡ'){
+                                    return 0xC9;
+                                }else{
+                                    if(c < U'ˣ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x10;
+                                    }
+                                }
+                            }else{
+                                if(c < U'˯'){
+                                    if(c < U'ˬ'){
+                                        return 0x42;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'˰'){
+                                        return 0xF9;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'˿'){
+                                if(c < U'˸'){
+                                    return 0x4E;
+                                }else{
+                                    if(c < U'˽'){
+                                        return 0xF3;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'̌'){
+                                    if(c < U'̄'){
+                                        return 0x58;
+                                    }else{
+                                        return 0x1C;
+                                    }
+                                }else{
+                                    if(c < U'̎'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xA9;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'҅'){
+            if(c < U'υ'){
+                if(c < U'ͪ'){
+                    if(c < U'̼'){
+                        if(c < U'̧'){
+                            if(c < U'̞'){
+                                if(c < U'̔'){
+                                    return 0x96;
+                                }else{
+                                    if(c < U'̗'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x3E;
+                                    }
+                                }
+                            }else{
+                                if(c < U'̡'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'̥'){
+                                        return 0xE4;
+                                    }else{
+                                        return 0xA4;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'̬'){
+                                if(c < U'̨'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'̩'){
+                                        return 0xDF;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'̴'){
+                                    if(c < U'̮'){
+                                        return 0x94;
+                                    }else{
+                                        return 0x44;
+                                    }
+                                }else{
+                                    if(c < U'̶'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x86;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'͕'){
+                            if(c < U'͈'){
+                                if(c < U'͂'){
+                                    return 0xAF;
+                                }else{
+                                    if(c < U'͇'){
+                                        return 0xA7;
+                                    }else{
+                                        return 0x63;
+                                    }
+                                }
+                            }else{
+                                if(c < U'͐'){
+                                    if(c < U'͊'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB0;
+                                    }
+                                }else{
+                                    if(c < U'͒'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xAA;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'͞'){
+                                if(c < U'͗'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'͝'){
+                                        return 0x66;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ͦ'){
+                                    if(c < U'ͣ'){
+                                        return 0xD1;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ͩ'){
+                                        return 0x64;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ΐ'){
+                        if(c < U'͹'){
+                            if(c < U'ͳ'){
+                                if(c < U'ͮ'){
+                                    return 0xEA;
+                                }else{
+                                    if(c < U'Ͱ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x95;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ͷ'){
+                                    if(c < U'ʹ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x35;
+                                    }
+                                }else{
+                                    if(c < U'ͷ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xE2;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'΅'){
+                                if(c < U'ͻ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ϳ'){
+                                        return 0x12;
+                                    }else{
+                                        return 0x80;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ύ'){
+                                    if(c < U'Έ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x38;
+                                    }
+                                }else{
+                                    if(c < U'Ώ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xC2;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ω'){
+                            if(c < U'Η'){
+                                if(c < U'Γ'){
+                                    return 0x2;
+                                }else{
+                                    if(c < U'Δ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xC8;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ρ'){
+                                    if(c < U'Ξ'){
+                                        return 0x53;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Φ'){
+                                        return 0xA0;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'δ'){
+                                if(c < U'Ϋ'){
+                                    return 0xE9;
+                                }else{
+                                    if(c < U'ή'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xF7;
+                                    }
+                                }
+                            }else{
+                                if(c < U'λ'){
+                                    if(c < U'ε'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xB5;
+                                    }
+                                }else{
+                                    if(c < U'ξ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xA7;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'Ф'){
+                    if(c < U'Ϲ'){
+                        if(c < U'ϣ'){
+                            if(c < U'ϖ'){
+                                if(c < U'ύ'){
+                                    return 0x5B;
+                                }else{
+                                    if(c < U'ϓ'){
+                                        return 0xDB;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ϛ'){
+                                    return 0x4A;
+                                }else{
+                                    if(c < U'ϝ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x37;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Ϯ'){
+                                if(c < U'Ϩ'){
+                                    return 0x20;
+                                }else{
+                                    if(c < U'Ϭ'){
+                                        return 0xF8;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ϴ'){
+                                    if(c < U'ϱ'){
+                                        return 0xB8;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'϶'){
+                                        return 0x5A;
+                                    }else{
+                                        return 0xD1;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ќ'){
+                            if(c < U'Ѐ'){
+                                if(c < U'Ͻ'){
+                                    return 0xD6;
+                                }else{
+                                    if(c < U'Ͼ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x56;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Љ'){
+                                    if(c < U'Ѓ'){
+                                        return 0x59;
+                                    }else{
+                                        return 0x72;
+                                    }
+                                }else{
+                                    if(c < U'Њ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xF9;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'В'){
+                                if(c < U'Ў'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'А'){
+                                        return 0xC4;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'И'){
+                                    if(c < U'З'){
+                                        return 0xC;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'П'){
+                                        return 0x47;
+                                    }else{
+                                        return 0x88;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'є'){
+                        if(c < U'л'){
+                            if(c < U'б'){
+                                if(c < U'Ч'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Я'){
+                                        return 0x8E;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'е'){
+                                    if(c < U'в'){
+                                        return 0x12;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'з'){
+                                        return 0x36;
+                                    }else{
+                                        return 0x96;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ц'){
+                                if(c < U'о'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'х'){
+                                        return 0x1A;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ё'){
+                                    if(c < U'ю'){
+                                        return 0xDC;
+                                    }else{
+                                        return 0xD9;
+                                    }
+                                }else{
+                                    if(c < U'ѓ'){
+                                        return 0xAA;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ѯ'){
+                            if(c < U'ѝ'){
+                                if(c < U'ѕ'){
+                                    return 0xA0;
+                                }else{
+                                    if(c < U'ј'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xF0;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ѩ'){
+                                    if(c < U'Ѡ'){
+                                        return 0x44;
+                                    }else{
+                                        return 0x1D;
+                                    }
+                                }else{
+                                    if(c < U'ѫ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x24;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ѵ'){
+                                if(c < U'Ѱ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ѳ'){
+                                        return 0x14;
+                                    }else{
+                                        return 0x7D;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ѽ'){
+                                    if(c < U'ѹ'){
+                                        return 0x57;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'҄'){
+                                        return 0x3A;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'Չ'){
+                if(c < U'ӣ'){
+                    if(c < U'Ү'){
+                        if(c < U'ҕ'){
+                            if(c < U'ҍ'){
+                                if(c < U'҆'){
+                                    return 0xB8;
+                                }else{
+                                    if(c < U'҈'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x6D;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ҏ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ғ'){
+                                        return 0xE2;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ҡ'){
+                                if(c < U'Қ'){
+                                    return 0x38;
+                                }else{
+                                    if(c < U'Ҝ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x3D;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ҭ'){
+                                    if(c < U'Ҥ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xEB;
+                                    }
+                                }else{
+                                    if(c < U'ҭ'){
+                                        return 0xBD;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'Ӌ'){
+                            if(c < U'Ҽ'){
+                                if(c < U'ҳ'){
+                                    return 0xFF;
+                                }else{
+                                    if(c < U'Һ'){
+                                        return 0xC8;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ӂ'){
+                                    if(c < U'Ҿ'){
+                                        return 0x94;
+                                    }else{
+                                        return 0xCE;
+                                    }
+                                }else{
+                                    if(c < U'Ӄ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x2C;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Ӕ'){
+                                if(c < U'Ӎ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ӓ'){
+                                        return 0x23;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ӛ'){
+                                    if(c < U'Ә'){
+                                        return 0x7E;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ӣ'){
+                                        return 0x68;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Ԑ'){
+                        if(c < U'ӽ'){
+                            if(c < U'ӯ'){
+                                if(c < U'ө'){
+                                    return 0xDB;
+                                }else{
+                                    if(c < U'Ӭ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x2C;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ӷ'){
+                                    if(c < U'ӱ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x3A;
+                                    }
+                                }else{
+                                    if(c < U'Ӹ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x43;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ԃ'){
+                                if(c < U'Ӿ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'Ԁ'){
+                                        return 0x7;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ԇ'){
+                                    if(c < U'ԅ'){
+                                        return 0x4B;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ԏ'){
+                                        return 0xD6;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'԰'){
+                            if(c < U'Ԟ'){
+                                if(c < U'ԗ'){
+                                    return 0x61;
+                                }else{
+                                    if(c < U'ԝ'){
+                                        return 0x4D;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Ԧ'){
+                                    if(c < U'ԣ'){
+                                        return 0xE2;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ԯ'){
+                                        return 0xA1;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'Է'){
+                                if(c < U'Բ'){
+                                    return 0xDA;
+                                }else{
+                                    if(c < U'Ե'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x5D;
+                                    }
+                                }
+                            }else{
+                                if(c < U'Կ'){
+                                    if(c < U'Խ'){
+                                        return 0xA9;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'Ն'){
+                                        return 0x5D;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'֣'){
+                    if(c < U'ո'){
+                        if(c < U'՞'){
+                            if(c < U'՘'){
+                                if(c < U'Վ'){
+                                    return 0x96;
+                                }else{
+                                    if(c < U'Օ'){
+                                        return 0xF7;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'՜'){
+                                    return 0x4B;
+                                }else{
+                                    if(c < U'՝'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xDE;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ը'){
+                                if(c < U'ՠ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'է'){
+                                        return 0x4F;
+                                    }else{
+                                        return 0xB;
+                                    }
+                                }
+                            }else{
+                                if(c < U'կ'){
+                                    if(c < U'ժ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xA4;
+                                    }
+                                }else{
+                                    if(c < U'ձ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x32;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'֎'){
+                            if(c < U'տ'){
+                                if(c < U'ռ'){
+                                    return 0xF2;
+                                }else{
+                                    if(c < U'վ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x9D;
+                                    }
+                                }
+                            }else{
+                                if(c < U'֊'){
+                                    if(c < U'ւ'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xA4;
+                                    }
+                                }else{
+                                    if(c < U'֍'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xAB;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'֕'){
+                                if(c < U'֏'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'֒'){
+                                        return 0xEB;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'֟'){
+                                    if(c < U'֙'){
+                                        return 0xD3;
+                                    }else{
+                                        return 0x7E;
+                                    }
+                                }else{
+                                    if(c < U'֢'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xAC;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ו'){
+                        if(c < U'ֿ'){
+                            if(c < U'֪'){
+                                if(c < U'֥'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'֨'){
+                                        return 0xC4;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ֳ'){
+                                    if(c < U'ֲ'){
+                                        return 0xA4;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ָ'){
+                                        return 0xBB;
+                                    }else{
+                                        return 0x79;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'ׇ'){
+                                if(c < U'ׂ'){
+                                    return 0xA9;
+                                }else{
+                                    if(c < U'׃'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0x98;
+                                    }
+                                }
+                            }else{
+                                if(c < U'ב'){
+                                    if(c < U'׊'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xAA;
+                                    }
+                                }else{
+                                    if(c < U'ד'){
+                                        return default_categories_set;
+                                    }else{
+                                        return 0xAD;
+                                    }
+                                }
+                            }
+                        }
+                    }else{
+                        if(c < U'׮'){
+                            if(c < U'ך'){
+                                if(c < U'ז'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ט'){
+                                        return 0x5E;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'פ'){
+                                    if(c < U'ס'){
+                                        return 0x4A;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'ש'){
+                                        return 0xE3;
+                                    }else{
+                                        return 0x6D;
+                                    }
+                                }
+                            }
+                        }else{
+                            if(c < U'״'){
+                                if(c < U'װ'){
+                                    return default_categories_set;
+                                }else{
+                                    if(c < U'ײ'){
+                                        return 0x1D;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }else{
+                                if(c < U'׽'){
+                                    if(c < U'׻'){
+                                        return 0x4E;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }else{
+                                    if(c < U'׾'){
+                                        return 0xAF;
+                                    }else{
+                                        return default_categories_set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x4C, 0x4C, 0x4C, 0x1,  0x50, 0x1,  0x72, 0x72, 
+    0x72, 0x72, 0x72, 0x72, 0x72, 0xCC, 0xCC, 0xCC, 
+    0xCC, 0x1,  0x1,  0x8B, 0x51, 0x51, 0x51, 0x51, 
+    0x51, 0x51, 0x51, 0x1,  0x1,  0x18, 0x18, 0x18, 
+    0x18, 0x18, 0x18, 0x18, 0x25, 0x25, 0x25, 0x1,  
+    0x1,  0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 
+    0xE9, 0x1,  0x52, 0x1,  0x1,  0x2A, 0xD4, 0xD4, 
+    0xD4, 0xD4, 0xD4, 0x1,  0x1A, 0x1A, 0x1A, 0x1A, 
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1,  
+    0x1,  0x1F, 0x58, 0x58, 0x58, 0x58, 0x1,  0x64, 
+    0x64, 0x64, 0x1,  0x1,  0x1,  0x5F, 0x5F, 0x5F, 
+    0x5F, 0x5F, 0x5F, 0x5F, 0xDC, 0xDC, 0xDC, 0xDC
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x63, 0x6B, 0xCB, 0xEF, 0xFB, 0xDF, 0xDB, 0xDB, 0xDB, 0xDB, 0x9B, 0xBB, 0x1B, 0x13, 0x53, 0x13, 
+    0x40, 0x40, 0x60, 0x48, 0x40, 0xE0, 0xC4, 0x84, 0x84, 0xC4, 0x84, 0x84, 0x24, 0x20, 0x20, 0x20, 
+    0x8C, 0x84, 0x4,  0x0,  0x10, 0x90, 0xB0, 0xA0, 0xA0, 0xE0, 0xA0, 0x80, 0x80, 0x84, 0x84, 0xC4, 
+    0x3C, 0x14, 0x14, 0x18, 0x0,  0xA0, 0x80, 0x80, 0x80, 0xD0, 0xD0, 0xD0, 0xF0, 0xFC, 0xBC, 0xBC, 
+    0x50, 0x50, 0x70, 0x50, 0x4C, 0xC8, 0xEC, 0xAC, 0xAC, 0xEC, 0xEC, 0xC4, 0xE4, 0xE8, 0xA8, 0xA8, 
+    0xE0, 0xC0, 0x40, 0x40, 0x50, 0x70, 0x54, 0x4,  0x4,  0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x50, 
+    0xAC, 0x84, 0x24, 0x0,  0xC,  0x88, 0xAC, 0xAC, 0xAC, 0xBC, 0xFC, 0xD4, 0xD4, 0xD4, 0x94, 0xD4, 
+    0x28, 0x0,  0x0,  0x8,  0x0,  0x0,  0x20, 0x20, 0x20, 0x30, 0x30, 0x10, 0x90, 0x94, 0x94, 0x94
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0,   31},      {U'#', U'#'},    {U'%', U'%'},    {U'1', U'<'},    
+    {U'D', U'Q'},      {U'S', U'T'},    {U'[', U'['},    {U'`', U'i'},    
+    {U'n', U'n'},      {U'r', U'{'},    { 132,  133},    { 137,  138},    
+    { 141, U'£'},     {U'ª', U'ª'},  {U'°', U'¶'},  {U'È', U'Û'},  
+    {U'à', U'à'},    {U'ã', U'ö'},  {U'ÿ', U'Ĉ'},  {U'Ď', U'ğ'},  
+    {U'ĥ', U'Ī'},    {U'Ĵ', U'Ĵ'},  {U'Ĺ', U'Ĺ'},  {U'ľ', U'ł'},  
+    {U'ń', U'Ň'},    {U'Ŏ', U'ŕ'},  {U'ř', U'ş'},  {U'Ů', U'ů'},  
+    {U'Ŵ', U'Ƙ'},    {U'Ơ', U'Ʃ'},  {U'ƹ', U'ǅ'},  {U'ǉ', U'ǉ'},  
+    {U'Ǐ', U'Ǒ'},    {U'ǔ', U'ǖ'},  {U'ǟ', U'ǡ'},  {U'Ǫ', U'Ǭ'},  
+    {U'ǵ', U'Ȉ'},    {U'ȏ', U'ȑ'},  {U'Ț', U'Ȣ'},  {U'ȩ', U'ɗ'},  
+    {U'ɛ', U'ɨ'},    {U'ɪ', U'ʀ'},  {U'ʅ', U'ʢ'},  {U'ʫ', U'ˀ'},  
+    {U'ˉ', U'˒'},    {U'˘', U'ˢ'},  {U'ˬ', U'˱'},  {U'˸', U'˾'},  
+    {U'̌', U'̐'},    {U'̔', U'̖'},  {U'̞', U'̠'},  {U'̧', U'̫'},  
+    {U'̴', U'̵'},    {U'̼', U'͉'},  {U'͐', U'͑'},  {U'͕', U'͖'},  
+    {U'͝', U'ͥ'},    {U'ͩ', U'ͩ'},  {U'ͮ', U'Ͷ'},  {U'͹', U'ͺ'},  
+    {U'΅', U'·'},    {U'Ύ', U'Ύ'},  {U'Γ', U'Γ'},  {U'Η', U'Π'},  
+    {U'Φ', U'ϕ'},    {U'ϛ', U'Ϣ'},  {U'Ϭ', U'ϭ'},  {U'ϱ', U'ϳ'},  
+    {U'϶', U'ϸ'},    {U'Ͻ', U'Ͻ'},  {U'Ѐ', U'Ђ'},  {U'Љ', U'Ѝ'},  
+    {U'А', U'Б'},    {U'З', U'О'},  {U'Ф', U'Ц'},  {U'Я', U'а'},  
+    {U'в', U'д'},    {U'л', U'н'},  {U'х', U'х'},  {U'ю', U'ѐ'},  
+    {U'ѓ', U'ѓ'},    {U'ѕ', U'ї'},  {U'Ѡ', U'Ѫ'},  {U'Ѯ', U'ѯ'},  
+    {U'ѳ', U'ѻ'},    {U'҄', U'҄'},  {U'҆', U'Ҏ'},  {U'Ғ', U'Ҕ'},  
+    {U'Қ', U'Ҳ'},    {U'Һ', U'һ'},  {U'ӂ', U'ӂ'},  {U'Ӌ', U'ӓ'},  
+    {U'Ә', U'Ӛ'},    {U'Ӣ', U'ӫ'},  {U'ӯ', U'Ӱ'},  {U'Ӷ', U'Ԇ'},  
+    {U'Ԏ', U'ԝ'},    {U'ԣ', U'ԯ'},  {U'Բ', U'Ո'},  {U'Վ', U'՜'},  
+    {U'՞', U'թ'},    {U'կ', U'հ'},  {U'ռ', U'ց'},  {U'֊', U'֘'},  
+    {U'֟', U'֡'},    {U'֣', U'֤'},  {U'֨', U'֩'},  {U'ֲ', U'ׂ'},  
+    {U'ׇ', U'׉'},    {U'ב', U'ו'},  {U'ט', U'י'},  {U'ס', U'׳'},  
+    {U'׻', 1114111},  {U'&', U','},    {U'3', U'3'},    {U'R', U'R'},    
+    {U'U', U'U'},      {U'\\', U'f'},   {U'i', U'i'},    {U'u', U'{'},    
+    { 134,  136},      { 143,  143},    { 146,  147},    {U'¤', U'©'},  
+    {U'«', U'¯'},    {U'·', U'½'},  {U'È', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ü', U'ß'},  {U'ä', U'ë'},  {U'ï', U'ï'},  
+    {U'÷', U'þ'},    {U'Ă', U'ą'},  {U'ĉ', U'č'},  {U'đ', U'ĕ'},  
+    {U'Ġ', U'Ĥ'},    {U'ħ', U'ĩ'},  {U'ŀ', U'ł'},  {U'Ŏ', U'Œ'},  
+    {U'Ŗ', U'Ş'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'ƅ', U'ƈ'},    {U'ƒ', U'Ƙ'},  {U'ƪ', U'Ƹ'},  {U'ǒ', U'Ǔ'},  
+    {U'ǭ', U'Ǵ'},    {U'Ƕ', U'ǹ'},  {U'Ȝ', U'ȡ'},  {U'Ȱ', U'ȸ'},  
+    {U'ɀ', U'Ɂ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɚ'},  
+    {U'ɩ', U'ɩ'},    {U'ɫ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʍ', U'ʔ'},  
+    {U'ʣ', U'ʪ'},    {U'ʭ', U'ʯ'},  {U'ʳ', U'ʶ'},  {U'ʺ', U'ʼ'},  
+    {U'ʾ', U'ˈ'},    {U'˓', U'˗'},  {U'˧', U'˫'},  {U'˲', U'˼'},  
+    {U'̑', U'̓'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̶', U'͇'},  
+    {U'͒', U'͔'},    {U'͗', U'͜'},  {U'ͪ', U'ͭ'},  {U'ͷ', U'͸'},  
+    {U'ͻ', U';'},    {U'Ώ', U'Β'},  {U'Η', U'Ν'},  {U'ή', U'γ'},  
+    {U'ξ', U'ϒ'},    {U'ϖ', U'Ϛ'},  {U'ϝ', U'Ϣ'},  {U'ϴ', U'ϵ'},  
+    {U'Ϲ', U'ϼ'},    {U'Ͼ', U'Ͽ'},  {U'Ѓ', U'Ј'},  {U'И', U'О'},  
+    {U'Ч', U'Ю'},    {U'б', U'б'},  {U'е', U'к'},  {U'о', U'ф'},  
+    {U'ё', U'ђ'},    {U'ѵ', U'Ѹ'},  {U'Ѽ', U'҃'},  {U'ҏ', U'ґ'},  
+    {U'Ҥ', U'ҫ'},    {U'Ү', U'Ҳ'},  {U'Ҿ', U'Ӂ'},  {U'Ӎ', U'Ӓ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӣ', U'Ө'},  {U'ӱ', U'ӵ'},  {U'Ӹ', U'Ӽ'},  
+    {U'Ӿ', U'ӿ'},    {U'ԃ', U'Ԅ'},  {U'ԇ', U'ԍ'},  {U'Ԟ', U'Ԣ'},  
+    {U'԰', U'Ա'},    {U'Չ', U'Ք'},  {U'՘', U'՛'},  {U'՝', U'՝'},  
+    {U'ՠ', U'է'},    {U'ձ', U'ջ'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֕', U'֞'},    {U'ֳ', U'ַ'},  {U'׊', U'א'},  {U'ז', U'ח'},  
+    {U'ך', U'נ'},    {U'פ', U'ר'},  {U'״', U'׺'},  {U'׽', U'׽'},  
+    {  32, U'"'},      {U'-', U'0'},    {U'D', U'F'},    {U'V', U'Z'},    
+    {U'i', U'i'},      {U'o', U'q'},    {U'u',  131},    { 134,  136},    
+    { 139,  140},      { 146,  147},    { 151,  153},    { 156, U' '},   
+    {U'«', U'¯'},    {U'²', U'³'},  {U'¾', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'Û'},  {U'ð', U'þ'},  {U'đ', U'ĕ'},  
+    {U'ė', U'Ĝ'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'ĳ'},  
+    {U'ĵ', U'ĸ'},    {U'ŀ', U'ł'},  {U'ņ', U'ņ'},  {U'ř', U'Ş'},  
+    {U'Š', U'ŭ'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'Ɗ', U'Ǝ'},  
+    {U'Ƣ', U'Ʃ'},    {U'Ƽ', U'ǂ'},  {U'ǒ', U'Ǔ'},  {U'Ǣ', U'ǩ'},  
+    {U'ǽ', U'ǽ'},    {U'Ȁ', U'Ȇ'},  {U'Ȓ', U'ș'},  {U'Ȝ', U'ȡ'},  
+    {U'Ɋ', U'Ɍ'},    {U'Ɏ', U'ɐ'},  {U'ɩ', U'ɩ'},  {U'ɰ', U'ɶ'},  
+    {U'ʭ', U'ʯ'},    {U'ʺ', U'ʼ'},  {U'ˁ', U'ˈ'},  {U'ˋ', U'ˑ'},  
+    {U'˓', U'˕'},    {U'˲', U'˷'},  {U'̄', U'̋'},  {U'̑', U'̓'},  
+    {U'̗', U'̝'},    {U'̡', U'̦'},  {U'̨', U'̨'},  {U'̬', U'̳'},  
+    {U'̶', U'͆'},    {U'͗', U'͜'},  {U'ͦ', U'ͨ'},  {U'Ͱ', U'Ͳ'},  
+    {U'ʹ', U'͵'},    {U'ή', U'γ'},  {U'ε', U'κ'},  {U'ξ', U'τ'},  
+    {U'ϝ', U'Ϣ'},    {U'Ϲ', U'ϼ'},  {U'Ͼ', U'Ͽ'},  {U'Ў', U'Џ'},  
+    {U'В', U'Ж'},    {U'И', U'О'},  {U'Ч', U'Ю'},  {U'е', U'к'},  
+    {U'ц', U'э'},    {U'ѝ', U'ѧ'},  {U'ѫ', U'ѭ'},  {U'Ѱ', U'Ѹ'},  
+    {U'҈', U'Ҍ'},    {U'Ҝ', U'Ҡ'},  {U'Ҭ', U'Ҭ'},  {U'Ү', U'Ҳ'},  
+    {U'Ҽ', U'Ӂ'},    {U'Ӄ', U'ӊ'},  {U'Ӕ', U'ӗ'},  {U'Ӭ', U'Ӯ'},  
+    {U'Ӿ', U'ӿ'},    {U'ԇ', U'ԍ'},  {U'ԗ', U'Ԝ'},  {U'Ե', U'Զ'},  
+    {U'Կ', U'Յ'},    {U'Չ', U'Ք'},  {U'՝', U'՝'},  {U'ՠ', U'զ'},  
+    {U'ժ', U'ծ'},    {U'վ', U'վ'},  {U'ւ', U'։'},  {U'֙', U'֞'},  
+    {U'֢', U'֢'},    {U'֥', U'֧'},  {U'֪', U'ֱ'},  {U'ד', U'ה'},  
+    {U'ז', U'ח'},    {U'ש', U'׭'},  {U'װ', U'ױ'},  {U'״', U'׺'},  
+    {U'׽', U'׽'},    {  32, U'"'},    {U'-', U'0'},    {U'3', U'3'},    
+    {U'=', U'C'},      {U'I', U'P'},    {U'U', U'U'},    {U'\\', U'_'},   
+    {U'i', U'm'},      {U'u',  131},    { 143,  143},    { 146,  147},    
+    { 151,  153},      { 156, U' '},   {U'«', U'¯'},  {U'·', U'Ç'},  
+    {U'Ê', U'Ð'},    {U'Ô', U'Ö'},  {U'á', U'â'},  {U'ï', U'ï'},  
+    {U'ø', U'þ'},    {U'Ă', U'ą'},  {U'ĉ', U'č'},  {U'Ġ', U'Ĥ'},  
+    {U'ı', U'ĳ'},    {U'ĵ', U'ĸ'},  {U'Ń', U'Ń'},  {U'ņ', U'ņ'},  
+    {U'Ŗ', U'Ř'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'Ɗ', U'Ǝ'},    {U'ƒ', U'Ɵ'},  {U'Ƭ', U'Ƶ'},  {U'Ǌ', U'ǎ'},  
+    {U'Ǘ', U'Ǟ'},    {U'Ǣ', U'ǩ'},  {U'ǭ', U'Ǵ'},  {U'ȉ', U'Ȏ'},  
+    {U'ȫ', U'Ȭ'},    {U'ȳ', U'ȸ'},  {U'Ƀ', U'Ɉ'},  {U'ɒ', U'ɚ'},  
+    {U'ɢ', U'ɦ'},    {U'ɫ', U'ɴ'},  {U'ʈ', U'ʉ'},  {U'ʗ', U'ʙ'},  
+    {U'ʜ', U'ʡ'},    {U'ʭ', U'ʯ'},  {U'ʺ', U'ʼ'},  {U'˓', U'˗'},  
+    {U'˛', U'ˠ'},    {U'˯', U'˯'},  {U'˲', U'˷'},  {U'˿', U'̋'},  
+    {U'̎', U'̐'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̼', U'́'},  
+    {U'͒', U'͔'},    {U'ͪ', U'ͭ'},  {U'Έ', U'΍'},  {U'Δ', U'Ζ'},  
+    {U'Ω', U'Ϊ'},    {U'υ', U'ϒ'},  {U'ϖ', U'Ϛ'},  {U'Ϩ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'ϴ', U'ϵ'},  {U'Ѐ', U'Ђ'},  {U'Њ', U'Ћ'},  
+    {U'В', U'Ж'},    {U'П', U'У'},  {U'Ч', U'Ю'},  {U'о', U'ф'},  
+    {U'ц', U'ђ'},    {U'Ѡ', U'ѧ'},  {U'ѳ', U'Ѵ'},  {U'Ѽ', U'҃'},  
+    {U'҅', U'҅'},    {U'҈', U'Ҍ'},  {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  
+    {U'Ҥ', U'Ҭ'},    {U'Ү', U'ҹ'},  {U'Ҿ', U'Ӂ'},  {U'Ӄ', U'ӊ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӛ', U'ӡ'},  {U'ӣ', U'Ө'},  {U'Ӭ', U'Ӯ'},  
+    {U'ӱ', U'ӵ'},    {U'ԃ', U'Ԅ'},  {U'ԗ', U'Ԝ'},  {U'԰', U'Ա'},  
+    {U'Ե', U'Լ'},    {U'Կ', U'Յ'},  {U'՘', U'՛'},  {U'՝', U'՝'},  
+    {U'ՠ', U'է'},    {U'վ', U'վ'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֙', U'֞'},    {U'֢', U'֢'},  {U'ֳ', U'ׁ'},  {U'׃', U'׆'},  
+    {U'׊', U'א'},    {U'ד', U'ה'},  {U'ז', U'ח'},  {U'ך', U'נ'},  
+    {U'ש', U'׭'},    {U'װ', U'ױ'},  {U'״', U'׺'},  {U'׽', U'׽'},  
+    {U'$', U'$'},      {U'&', U','},    {U'4', U':'},    {U'=', U'C'},    
+    {U'R', U'R'},      {U'V', U'Z'},    {U'\\', U'f'},   {U'i', U'm'},    
+    {U'u',  131},      { 143,  143},    { 151,  153},    { 156, U' '},   
+    {U'¤', U'©'},    {U'«', U'¯'},  {U'²', U'³'},  {U'¾', U'Ç'},  
+    {U'Ê', U'Ð'},    {U'Ô', U'Ö'},  {U'á', U'â'},  {U'ä', U'ë'},  
+    {U'ð', U'ö'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'ĳ'},  
+    {U'ĵ', U'ĸ'},    {U'ĺ', U'Ľ'},  {U'ŀ', U'ł'},  {U'ņ', U'ņ'},  
+    {U'ň', U'Œ'},    {U'Ŗ', U'Ş'},  {U'Ũ', U'ŭ'},  {U'ƅ', U'ƈ'},  
+    {U'Ɗ', U'Ǝ'},    {U'Ƣ', U'ƫ'},  {U'ƶ', U'Ƹ'},  {U'ǆ', U'ǈ'},  
+    {U'Ǌ', U'ǎ'},    {U'Ǘ', U'Ǟ'},  {U'ǽ', U'ǽ'},  {U'ȉ', U'Ȏ'},  
+    {U'Ȝ', U'ȡ'},    {U'ȣ', U'Ȩ'},  {U'ȫ', U'Ȭ'},  {U'ȳ', U'ȸ'},  
+    {U'Ƀ', U'Ɉ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɗ'},  
+    {U'ɢ', U'ɦ'},    {U'ɵ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʍ', U'ʔ'},  
+    {U'ʗ', U'ʙ'},    {U'ʣ', U'ʪ'},  {U'ʳ', U'ʶ'},  {U'ˁ', U'ˈ'},  
+    {U'ˣ', U'˦'},    {U'˯', U'˯'},  {U'˸', U'˼'},  {U'˿', U'̋'},  
+    {U'̑', U'̓'},    {U'̗', U'̝'},  {U'̨', U'̨'},  {U'̬', U'̭'},  
+    {U'͊', U'͏'},    {U'͞', U'͢'},  {U'Ͱ', U'Ͳ'},  {U'ʹ', U'͵'},  
+    {U'ͻ', U';'},    {U'Έ', U'΍'},  {U'Η', U'Ν'},  {U'ή', U'γ'},  
+    {U'ε', U'κ'},    {U'υ', U'ϒ'},  {U'ϝ', U'Ϣ'},  {U'Ϩ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'ϴ', U'ϼ'},  {U'Ͼ', U'Ј'},  {U'Њ', U'Ћ'},  
+    {U'б', U'б'},    {U'е', U'к'},  {U'о', U'ф'},  {U'ц', U'ѐ'},  
+    {U'ј', U'ќ'},    {U'Ѡ', U'ѧ'},  {U'Ѱ', U'Ѹ'},  {U'Ѽ', U'҃'},  
+    {U'҅', U'҅'},    {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  {U'Ҭ', U'Ҭ'},  
+    {U'Ү', U'Ҳ'},    {U'Ҽ', U'ҽ'},  {U'Ӕ', U'ӗ'},  {U'ӣ', U'Ө'},  
+    {U'ӱ', U'ӵ'},    {U'ԇ', U'ԍ'},  {U'԰', U'Ա'},  {U'Ե', U'Զ'},  
+    {U'Կ', U'Յ'},    {U'Չ', U'Ք'},  {U'՝', U'՝'},  {U'ձ', U'ջ'},  
+    {U'վ', U'վ'},    {U'֕', U'֞'},  {U'ֳ', U'־'},  {U'׃', U'׆'},  
+    {U'ז', U'ח'},    {U'װ', U'ױ'},  {U'&', U','},    {U'D', U'F'},    
+    {U'I', U'P'},      {U'U', U'U'},    {U'`', U'f'},    {U'o', U'q'},    
+    { 134,  136},      { 151,  153},    {U'¤', U'©'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'ß'},  {U'á', U'â'},  {U'ä', U'ë'},  
+    {U'ð', U'ö'},    {U'ø', U'þ'},  {U'Ă', U'ą'},  {U'Ġ', U'Ĥ'},  
+    {U'ī', U'ĳ'},    {U'ŀ', U'ł'},  {U'Ŏ', U'Œ'},  {U'Ŗ', U'Ş'},  
+    {U'Š', U'ŧ'},    {U'ſ', U'ƃ'},  {U'ƅ', U'ƈ'},  {U'Ɗ', U'Ǝ'},  
+    {U'Ƣ', U'Ʃ'},    {U'Ƭ', U'Ƹ'},  {U'ǆ', U'ǈ'},  {U'Ǌ', U'ǎ'},  
+    {U'Ƕ', U'ǹ'},    {U'ȣ', U'Ȩ'},  {U'ȫ', U'Ȭ'},  {U'Ƀ', U'Ɉ'},  
+    {U'Ɋ', U'Ɍ'},    {U'Ɏ', U'ɐ'},  {U'ɒ', U'ɞ'},  {U'ɩ', U'ɩ'},  
+    {U'ɫ', U'ɯ'},    {U'ɵ', U'ɶ'},  {U'ɹ', U'ɽ'},  {U'ʁ', U'ʄ'},  
+    {U'ʈ', U'ʉ'},    {U'ʍ', U'ʔ'},  {U'ʜ', U'ʡ'},  {U'ʳ', U'ʶ'},  
+    {U'ʺ', U'ʼ'},    {U'ʾ', U'ˈ'},  {U'ˋ', U'ˑ'},  {U'˓', U'˗'},  
+    {U'˯', U'˯'},    {U'˸', U'˼'},  {U'̎', U'̐'},  {U'̗', U'̝'},  
+    {U'̡', U'̦'},    {U'̼', U'͇'},  {U'͊', U'͏'},  {U'͒', U'͔'},  
+    {U'͗', U'͜'},    {U'ͦ', U'ͨ'},  {U'ͪ', U'ͭ'},  {U'ʹ', U'͵'},  
+    {U'ͷ', U'͸'},    {U'Έ', U'΍'},  {U'Ρ', U'Υ'},  {U'Ω', U'Ϊ'},  
+    {U'ή', U'γ'},    {U'ε', U'κ'},  {U'ξ', U'τ'},  {U'ϝ', U'ϫ'},  
+    {U'Ϯ', U'ϰ'},    {U'Ѓ', U'Ј'},  {U'Њ', U'Ћ'},  {U'е', U'ж'},  
+    {U'ё', U'ђ'},    {U'є', U'є'},  {U'ј', U'ќ'},  {U'ѫ', U'ѭ'},  
+    {U'ѳ', U'Ѵ'},    {U'Ѽ', U'҃'},  {U'҅', U'҅'},  {U'҈', U'Ҍ'},  
+    {U'ҏ', U'ґ'},    {U'ҕ', U'ҙ'},  {U'Ҝ', U'Ҡ'},  {U'Ҥ', U'Ҭ'},  
+    {U'Ү', U'Ҳ'},    {U'Ӄ', U'ӊ'},  {U'Ӎ', U'Ӓ'},  {U'Ӕ', U'ӗ'},  
+    {U'ӛ', U'ӡ'},    {U'Ӭ', U'Ӯ'},  {U'ӱ', U'ӵ'},  {U'Ԑ', U'Ԗ'},  
+    {U'Ԟ', U'Ԣ'},    {U'Ԧ', U'ԭ'},  {U'Է', U'Լ'},  {U'Վ', U'Ք'},  
+    {U'ժ', U'ծ'},    {U'ձ', U'ջ'},  {U'ւ', U'։'},  {U'֍', U'֍'},  
+    {U'֏', U'֑'},    {U'֙', U'֞'},  {U'֢', U'֢'},  {U'֪', U'ֱ'},  
+    {U'ֳ', U'ׁ'},    {U'׊', U'א'},  {U'ד', U'ה'},  {U'פ', U'׭'},  
+    {U'׽', U'׽'},    {  32, U'"'},    {U'$', U'$'},    {U'&', U'0'},    
+    {U'4', U':'},      {U'I', U'P'},    {U'R', U'R'},    {U'V', U'Z'},    
+    {U'j', U'm'},      {U'o', U'q'},    {U'u',  131},    { 139,  140},    
+    { 143,  143},      { 151,  153},    {U'¾', U'Ç'},  {U'Ô', U'Ö'},  
+    {U'Ù', U'Û'},    {U'ç', U'ë'},  {U'ï', U'ï'},  {U'Ă', U'ą'},  
+    {U'đ', U'ĕ'},    {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  {U'ī', U'İ'},  
+    {U'ĵ', U'ĸ'},    {U'ĺ', U'Ľ'},  {U'Ń', U'Ń'},  {U'ņ', U'ņ'},  
+    {U'ň', U'ō'},    {U'ř', U'Ş'},  {U'Ũ', U'ŭ'},  {U'Ŷ', U'Ż'},  
+    {U'ſ', U'ƃ'},    {U'Ɗ', U'Ǝ'},  {U'ƪ', U'ƫ'},  {U'Ʋ', U'Ƶ'},  
+    {U'Ƽ', U'ǂ'},    {U'ǆ', U'ǈ'},  {U'Ǌ', U'ǎ'},  {U'ǒ', U'Ǔ'},  
+    {U'Ǘ', U'Ǟ'},    {U'Ǣ', U'ǩ'},  {U'ǭ', U'Ǵ'},  {U'Ƕ', U'ǹ'},  
+    {U'ȉ', U'Ȏ'},    {U'Ȓ', U'ș'},  {U'ȣ', U'Ȩ'},  {U'Ȱ', U'Ȳ'},  
+    {U'ȹ', U'Ⱦ'},    {U'ɒ', U'ɗ'},  {U'ɢ', U'ɦ'},  {U'ɩ', U'ɩ'},  
+    {U'ɰ', U'ɴ'},    {U'ʁ', U'ʄ'},  {U'ʗ', U'ʙ'},  {U'ʺ', U'ʼ'},  
+    {U'ʾ', U'ˀ'},    {U'ˋ', U'ˑ'},  {U'˛', U'ˠ'},  {U'˧', U'˫'},  
+    {U'˯', U'˯'},    {U'˲', U'˼'},  {U'˿', U'̃'},  {U'̡', U'̤'},  
+    {U'̨', U'̨'},    {U'̮', U'̳'},  {U'͇', U'͇'},  {U'͗', U'͜'},  
+    {U'͞', U'͢'},    {U'ͦ', U'ͨ'},  {U'ͪ', U'ͭ'},  {U'ͷ', U'͸'},  
+    {U'Ώ', U'Ώ'},    {U'Δ', U'Ν'},  {U'Ω', U'Ϊ'},  {U'ή', U'γ'},  
+    {U'υ', U'ϒ'},    {U'ϖ', U'Ϛ'},  {U'Ϩ', U'ϫ'},  {U'ϴ', U'ϼ'},  
+    {U'Ͼ', U'Ј'},    {U'Њ', U'Ћ'},  {U'Ў', U'Џ'},  {U'И', U'О'},  
+    {U'ц', U'ѐ'},    {U'ј', U'џ'},  {U'ѳ', U'Ѹ'},  {U'҈', U'Ҍ'},  
+    {U'ҏ', U'ґ'},    {U'Ҥ', U'ҫ'},  {U'Ү', U'ҹ'},  {U'Ҿ', U'Ӂ'},  
+    {U'Ӕ', U'ӗ'},    {U'ӛ', U'ӡ'},  {U'ӣ', U'Ө'},  {U'Ӹ', U'Ӽ'},  
+    {U'ԃ', U'Ԅ'},    {U'ԇ', U'ԍ'},  {U'Ԑ', U'Ԝ'},  {U'Ԟ', U'Ԣ'},  
+    {U'԰', U'Ա'},    {U'Ե', U'Զ'},  {U'Կ', U'Յ'},  {U'Վ', U'Ք'},  
+    {U'՘', U'՛'},    {U'՝', U'՝'},  {U'ՠ', U'զ'},  {U'ո', U'ջ'},  
+    {U'֏', U'֑'},    {U'֕', U'֞'},  {U'֥', U'֧'},  {U'ָ', U'־'},  
+    {U'ז', U'ח'},    {U'ך', U'נ'},  {U'פ', U'׭'},  {U'״', U'׺'},  
+    {U'-', U'0'},      {U'3', U'3'},    {U'I', U'P'},    {U'V', U'Z'},    
+    {U'|',  131},      { 143,  143},    { 151,  153},    {U'¤', U'©'},  
+    {U'²', U'³'},    {U'·', U'À'},  {U'È', U'È'},  {U'Ê', U'Ð'},  
+    {U'Ô', U'Ö'},    {U'Ù', U'ß'},  {U'ï', U'ï'},  {U'÷', U'÷'},  
+    {U'Ă', U'ą'},    {U'ė', U'Ĝ'},  {U'Ġ', U'Ĥ'},  {U'ħ', U'ĩ'},  
+    {U'ī', U'ĳ'},    {U'ĵ', U'ĸ'},  {U'Ń', U'Ń'},  {U'ř', U'Ş'},  
+    {U'Ũ', U'ŭ'},    {U'Ű', U'ų'},  {U'Ŷ', U'Ż'},  {U'ſ', U'ƃ'},  
+    {U'ƅ', U'ƈ'},    {U'Ɗ', U'Ǝ'},  {U'ƙ', U'Ɵ'},  {U'Ƣ', U'Ʃ'},  
+    {U'Ʋ', U'Ƹ'},    {U'Ƽ', U'ǂ'},  {U'Ǌ', U'ǎ'},  {U'Ǘ', U'Ǟ'},  
+    {U'ȉ', U'Ȏ'},    {U'Ȝ', U'ȡ'},  {U'ȫ', U'Ȭ'},  {U'ɀ', U'Ɂ'},  
+    {U'Ƀ', U'Ɉ'},    {U'Ɋ', U'Ɍ'},  {U'Ɏ', U'ɐ'},  {U'ɘ', U'ɞ'},  
+    {U'ɢ', U'ɦ'},    {U'ɩ', U'ɩ'},  {U'ɫ', U'ɯ'},  {U'ɵ', U'ɶ'},  
+    {U'ɹ', U'ɽ'},    {U'ʁ', U'ʄ'},  {U'ʜ', U'ʡ'},  {U'ʭ', U'ʯ'},  
+    {U'ʳ', U'ʶ'},    {U'ʺ', U'ʼ'},  {U'ˁ', U'ˈ'},  {U'˛', U'ˠ'},  
+    {U'˯', U'˯'},    {U'˸', U'˼'},  {U'̎', U'̓'},  {U'̡', U'̦'},  
+    {U'̨', U'̨'},    {U'̬', U'̭'},  {U'̶', U'͆'},  {U'͊', U'͏'},  
+    {U'͒', U'͔'},    {U'͞', U'͢'},  {U'ͪ', U'ͭ'},  {U'Ͱ', U'Ͳ'},  
+    {U'ͷ', U'͸'},    {U'Ϳ', U'΄'},  {U'Ώ', U'Ώ'},  {U'Δ', U'Ζ'},  
+    {U'Ρ', U'Υ'},    {U'Ω', U'Ϊ'},  {U'ή', U'γ'},  {U'ε', U'κ'},  
+    {U'ξ', U'τ'},    {U'ύ', U'ϒ'},  {U'Ϩ', U'ϫ'},  {U'Ϯ', U'ϰ'},  
+    {U'϶', U'ϼ'},    {U'Њ', U'Ћ'},  {U'Ў', U'Џ'},  {U'П', U'У'},  
+    {U'Ч', U'Ю'},    {U'з', U'к'},  {U'ц', U'ђ'},  {U'є', U'є'},  
+    {U'ј', U'ќ'},    {U'҅', U'҅'},  {U'ҏ', U'ґ'},  {U'Ҥ', U'Ҭ'},  
+    {U'Ү', U'ҹ'},    {U'Ҽ', U'Ӂ'},  {U'ӣ', U'Ө'},  {U'ԇ', U'ԍ'},  
+    {U'Ԟ', U'Ԣ'},    {U'Ԧ', U'ԭ'},  {U'԰', U'Ա'},  {U'Է', U'Լ'},  
+    {U'Չ', U'Ք'},    {U'՝', U'՝'},  {U'ժ', U'ծ'},  {U'ո', U'ջ'},  
+    {U'վ', U'վ'},    {U'ւ', U'։'},  {U'֍', U'֍'},  {U'֏', U'֑'},  
+    {U'֕', U'֘'},    {U'֢', U'֢'},  {U'֥', U'֧'},  {U'֪', U'ֱ'},  
+    {U'ֳ', U'ַ'},    {U'ֿ', U'ׁ'},  {U'׃', U'׆'},  {U'׊', U'א'},  
+    {U'ד', U'ה'},    {U'פ', U'ר'},  {U'׽', U'׽'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    113,  224,  329,  444,  554,  665,  780,  
+    899
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113511,  589,  543,  592,  591,  586,  592,  565
+};
+
+} // namespace synthetic_unrolled_256
+
@@ -0,0 +1,296 @@
+#include "synthetic_unrolled_32.h"
+
+namespace synthetic_unrolled_32{
+Categories_set get_categories_set(char32_t c){
+    if(c <  129){
+        if(c < U'R'){
+            if(c < U'<'){
+                if(c < U')'){
+                    if(c < U'#'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'\''){
+                            return 0x4F;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }else{
+                    if(c < U'2'){
+                        if(c < U'.'){
+                            return 0xF7;
+                        }else{
+                            return 0xB1;
+                        }
+                    }else{
+                        if(c < U'5'){
+                            return default_categories_set;
+                        }else{
+                            return 0xD4;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'F'){
+                    if(c < U'?'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'E'){
+                            return 0xEF;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }else{
+                    if(c < U'L'){
+                        if(c < U'K'){
+                            return 0xC6;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c < U'P'){
+                            return 0x3;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'h'){
+                if(c < U'['){
+                    if(c < U'V'){
+                        return 0x11;
+                    }else{
+                        if(c < U'X'){
+                            return default_categories_set;
+                        }else{
+                            return 0x33;
+                        }
+                    }
+                }else{
+                    if(c < U'`'){
+                        if(c < U'^'){
+                            return 0x9A;
+                        }else{
+                            return 0x40;
+                        }
+                    }else{
+                        if(c < U'a'){
+                            return default_categories_set;
+                        }else{
+                            return 0x5;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'u'){
+                    if(c < U'k'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'r'){
+                            return 0x92;
+                        }else{
+                            return 0x63;
+                        }
+                    }
+                }else{
+                    if(c < U'~'){
+                        if(c < U'{'){
+                            return 0xF2;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c <  127){
+                            return 0x83;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'½'){
+            if(c <  157){
+                if(c <  145){
+                    if(c <  136){
+                        return 0x93;
+                    }else{
+                        if(c <  143){
+                            return 0x43;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }else{
+                    if(c <  148){
+                        if(c <  146){
+                            return 0xC4;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c <  154){
+                            return 0xB1;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'®'){
+                    if(c < U'£'){
+                        return 0x47;
+                    }else{
+                        if(c < U'«'){
+                            return 0xCA;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }else{
+                    if(c < U'·'){
+                        if(c < U'´'){
+                            return 0xB7;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c < U'»'){
+                            return 0x17;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'Ó'){
+                if(c < U'Å'){
+                    if(c < U'¿'){
+                        return 0xA;
+                    }else{
+                        if(c < U'À'){
+                            return default_categories_set;
+                        }else{
+                            return 0xC3;
+                        }
+                    }
+                }else{
+                    if(c < U'Í'){
+                        if(c < U'Ê'){
+                            return 0xD6;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c < U'Ð'){
+                            return 0xC0;
+                        }else{
+                            return 0xB9;
+                        }
+                    }
+                }
+            }else{
+                if(c < U'Ü'){
+                    if(c < U'Ô'){
+                        return default_categories_set;
+                    }else{
+                        if(c < U'Û'){
+                            return 0xB0;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }else{
+                    if(c < U'å'){
+                        if(c < U'ã'){
+                            return 0xD1;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }else{
+                        if(c < U'é'){
+                            return 0xD7;
+                        }else{
+                            return default_categories_set;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x4F, 0x4F, 0x4F, 0x4F, 0x1,  
+    0x1,  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB1, 0xB1, 
+    0xB1, 0xB1, 0x1,  0x1,  0x1,  0xD4, 0xD4, 0xD4, 
+    0xD4, 0xD4, 0xD4, 0xD4, 0x1,  0x1,  0x1,  0xEF, 
+    0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x1,  0xC6, 0xC6, 
+    0xC6, 0xC6, 0xC6, 0x1,  0x3,  0x3,  0x3,  0x3,  
+    0x1,  0x1,  0x11, 0x11, 0x11, 0x11, 0x1,  0x1,  
+    0x33, 0x33, 0x33, 0x9A, 0x9A, 0x9A, 0x40, 0x40, 
+    0x1,  0x5,  0x5,  0x5,  0x5,  0x5,  0x5,  0x5,  
+    0x1,  0x1,  0x1,  0x92, 0x92, 0x92, 0x92, 0x92, 
+    0x92, 0x92, 0x63, 0x63, 0x63, 0xF2, 0xF2, 0xF2, 
+    0xF2, 0xF2, 0xF2, 0x1,  0x1,  0x1,  0x83, 0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0x77, 0x67, 0x67, 0x67, 0x67, 0x67, 0x97, 0x9F, 0x9F, 0x9F, 0x9F, 
+    0x90, 0x90, 0x90, 0x94, 0x94, 0x84, 0x94, 0x90, 0xB0, 0xB4, 0xB4, 0x64, 0x74, 0x74, 0xD0, 0x58, 
+    0x10, 0x50, 0x50, 0x54, 0x54, 0x4C, 0x5C, 0x58, 0x18, 0x1C, 0x1C, 0xC,  0x4,  0x4,  0x0,  0x8,  
+    0x10, 0x10, 0x10, 0x14, 0x14, 0x4,  0x4,  0x0,  0x0,  0x0,  0x0,  0x20, 0x20, 0x20, 0x0,  0x8,  
+    0x88, 0x88, 0x20, 0x20, 0x20, 0xA8, 0x88, 0x88, 0xA8, 0xAC, 0xAC, 0x6C, 0x64, 0x64, 0x44, 0x44, 
+    0x18, 0x18, 0x90, 0x90, 0x90, 0x80, 0x80, 0x80, 0xA0, 0xA4, 0xA4, 0x4,  0x4,  0x4,  0x4,  0xC,  
+    0x10, 0x10, 0x90, 0x94, 0x94, 0x8C, 0x9C, 0x98, 0x98, 0x9C, 0x9C, 0xC,  0x4,  0x4,  0x20, 0x28, 
+    0x98, 0x98, 0x10, 0x10, 0x10, 0x88, 0x98, 0x98, 0x98, 0x9C, 0x9C, 0x6C, 0x64, 0x64, 0xC4, 0x4C
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'4'},    {U'<', U'E'},    {U'K', U'Z'},    {U'`', U'j'},      
+    {U'r', U't'},    {U'{',  144},    { 146, U'¢'},   {U'«', U'¼'},    
+    {U'¿', U'Ä'},  {U'Ê', U'Ì'},  {U'Ð', U'Ó'},  {U'Û', 1114111},  
+    {U'#', U'&'},    {U')', U'-'},    {U'?', U'D'},    {U'F', U'J'},      
+    {U'L', U'O'},    {U'X', U']'},    {U'k', U'z'},    {U'~', U'~'},      
+    { 129,  142},    { 157, U'ª'},   {U'®', U'³'},  {U'·', U'º'},    
+    {U'½', U'¾'},  {U'À', U'É'},  {U'å', U'è'},  {U'#', U'&'},      
+    {U')', U'-'},    {U'5', U';'},    {U'?', U'D'},    {U'F', U'J'},      
+    {U'a', U'g'},    { 145,  145},    { 157, U'¢'},   {U'®', U'³'},    
+    {U'·', U'º'},  {U'Å', U'É'},  {U'å', U'è'},  {U'#', U'&'},      
+    {U'?', U'D'},    {U'[', U']'},    {U'£', U'ª'},  {U'½', U'¾'},    
+    {U'Ð', U'Ò'},  {U')', U'1'},    {U'5', U';'},    {U'R', U'U'},      
+    {U'X', U']'},    {U'k', U'q'},    {U'u', U'z'},    { 129,  135},      
+    { 148,  153},    {U'®', U'³'},  {U'·', U'º'},  {U'Å', U'É'},    
+    {U'Ð', U'Ò'},  {U'Ô', U'Ú'},  {U'Ü', U'â'},  {U'å', U'è'},    
+    {U')', U'1'},    {U'?', U'D'},    {U'X', U'Z'},    {U'r', U'z'},      
+    { 148,  153},    {U'®', U'³'},  {U'Ð', U'Ò'},  {U'Ô', U'Ú'},    
+    {U'#', U'&'},    {U')', U'-'},    {U'5', U';'},    {U'?', U'D'},      
+    {U'F', U'J'},    {U'^', U'_'},    {U'r', U'z'},    { 136,  142},      
+    { 145,  145},    { 157, U'ª'},   {U'À', U'É'},  {U'Í', U'Ï'},    
+    {U'Ü', U'â'},  {U'å', U'è'},  {U')', U'1'},    {U'5', U';'},      
+    {U'?', U'D'},    {U'F', U'J'},    {U'[', U']'},    {U'k', U'q'},      
+    {U'u', U'z'},    {U'~', U'~'},    { 129,  135},    { 145,  145},      
+    { 148,  153},    {U'£', U'ª'},  {U'®', U'³'},  {U'À', U'É'},    
+    {U'Í', U'Ò'},  {U'Ô', U'Ú'},  {U'Ü', U'â'},  {U'å', U'è'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    12,  27,  39,  45,  60,  68,  82,  
+    100
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114056,  101,  60,  26,  88,  49,  84,  106
+};
+
+} // namespace synthetic_unrolled_32
+
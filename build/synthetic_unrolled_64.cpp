@@ -0,0 +1,525 @@
+#include "synthetic_unrolled_64.h"
+
+namespace synthetic_unrolled_64{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'ā'){
+        if(c <  153){
+            if(c < U'Y'){
+                if(c < U'<'){
+                    if(c < U')'){
+                        if(c <   32){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'\''){
+                                return 0x8F;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'0'){
+                            return 0x4A;
+                        }else{
+                            if(c < U'4'){
+                                return 0xB;
+                            }else{
+                                return 0x64;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'H'){
+                        if(c < U'>'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'E'){
+                                return 0x8E;
+                            }else{
+                                return 0xC1;
+                            }
+                        }
+                    }else{
+                        if(c < U'P'){
+                            if(c < U'I'){
+                                return default_categories_set;
+                            }else{
+                                return 0xE3;
+                            }
+                        }else{
+                            if(c < U'R'){
+                                return default_categories_set;
+                            }else{
+                                return 0x6C;
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U't'){
+                    if(c < U'e'){
+                        if(c < U'Z'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'b'){
+                                return 0x38;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'j'){
+                            return 0x3B;
+                        }else{
+                            if(c < U'r'){
+                                return 0x4C;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }
+                }else{
+                    if(c <  131){
+                        if(c < U'z'){
+                            return 0x37;
+                        }else{
+                            if(c < U'|'){
+                                return default_categories_set;
+                            }else{
+                                return 0xAD;
+                            }
+                        }
+                    }else{
+                        if(c <  140){
+                            if(c <  138){
+                                return 0x7A;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }else{
+                            if(c <  146){
+                                return 0xA5;
+                            }else{
+                                return 0xA4;
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'È'){
+                if(c < U'«'){
+                    if(c < U' '){
+                        if(c <  155){
+                            return default_categories_set;
+                        }else{
+                            if(c <  159){
+                                return 0x1B;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'¤'){
+                            return 0xF3;
+                        }else{
+                            if(c < U'§'){
+                                return default_categories_set;
+                            }else{
+                                return 0x2E;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'º'){
+                        if(c < U'³'){
+                            return 0x79;
+                        }else{
+                            if(c < U'¸'){
+                                return 0x2D;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'Á'){
+                            if(c < U'¾'){
+                                return 0x14;
+                            }else{
+                                return 0xD0;
+                            }
+                        }else{
+                            if(c < U'Â'){
+                                return default_categories_set;
+                            }else{
+                                return 0x58;
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'è'){
+                    if(c < U'Ó'){
+                        if(c < U'Ë'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'Ñ'){
+                                return 0x12;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ý'){
+                            if(c < U'Û'){
+                                return 0xCA;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }else{
+                            if(c < U'å'){
+                                return 0xFE;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ò'){
+                        if(c < U'î'){
+                            return 0xF7;
+                        }else{
+                            if(c < U'ð'){
+                                return 0xAB;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'û'){
+                            if(c < U'ú'){
+                                return 0xBC;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }else{
+                            if(c < U'ü'){
+                                return 0xE8;
+                            }else{
+                                return 0x1E;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }else{
+        if(c < U'Œ'){
+            if(c < U'Ī'){
+                if(c < U'Ĕ'){
+                    if(c < U'ĉ'){
+                        if(c < U'Ă'){
+                            return 0xA1;
+                        }else{
+                            if(c < U'Ą'){
+                                return default_categories_set;
+                            }else{
+                                return 0xE5;
+                            }
+                        }
+                    }else{
+                        if(c < U'Č'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'đ'){
+                                return 0x46;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'ĝ'){
+                        if(c < U'ĕ'){
+                            return 0xEF;
+                        }else{
+                            if(c < U'ė'){
+                                return default_categories_set;
+                            }else{
+                                return 0x51;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ġ'){
+                            if(c < U'Ğ'){
+                                return default_categories_set;
+                            }else{
+                                return 0xD0;
+                            }
+                        }else{
+                            if(c < U'ģ'){
+                                return default_categories_set;
+                            }else{
+                                return 0x4D;
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'ŀ'){
+                    if(c < U'Ĳ'){
+                        if(c < U'ī'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'ı'){
+                                return 0x75;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ĺ'){
+                            return 0x16;
+                        }else{
+                            if(c < U'ļ'){
+                                return default_categories_set;
+                            }else{
+                                return 0x71;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Ň'){
+                        if(c < U'Ņ'){
+                            return 0xB2;
+                        }else{
+                            if(c < U'ņ'){
+                                return default_categories_set;
+                            }else{
+                                return 0x18;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ō'){
+                            if(c < U'ŋ'){
+                                return 0x24;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }else{
+                            if(c < U'ő'){
+                                return 0x6D;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }
+                }
+            }
+        }else{
+            if(c < U'Ÿ'){
+                if(c < U'ŝ'){
+                    if(c < U'ŗ'){
+                        if(c < U'œ'){
+                            return 0x55;
+                        }else{
+                            if(c < U'Ŕ'){
+                                return default_categories_set;
+                            }else{
+                                return 0x43;
+                            }
+                        }
+                    }else{
+                        if(c < U'ř'){
+                            return 0xBD;
+                        }else{
+                            if(c < U'Ś'){
+                                return 0xE8;
+                            }else{
+                                return 0x8E;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Ũ'){
+                        if(c < U'ş'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'š'){
+                                return 0x3C;
+                            }else{
+                                return 0xEF;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ű'){
+                            if(c < U'ū'){
+                                return default_categories_set;
+                            }else{
+                                return 0xED;
+                            }
+                        }else{
+                            if(c < U'ų'){
+                                return default_categories_set;
+                            }else{
+                                return 0x70;
+                            }
+                        }
+                    }
+                }
+            }else{
+                if(c < U'Ə'){
+                    if(c < U'Ƃ'){
+                        if(c < U'Ź'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'ž'){
+                                return 0x40;
+                            }else{
+                                return 0x37;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ɔ'){
+                            if(c < U'ƅ'){
+                                return default_categories_set;
+                            }else{
+                                return 0x83;
+                            }
+                        }else{
+                            if(c < U'Ǝ'){
+                                return 0xB;
+                            }else{
+                                return 0x1B;
+                            }
+                        }
+                    }
+                }else{
+                    if(c < U'Ɠ'){
+                        if(c < U'Ɛ'){
+                            return default_categories_set;
+                        }else{
+                            if(c < U'Ƒ'){
+                                return 0x51;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }else{
+                        if(c < U'Ɨ'){
+                            if(c < U'Ɣ'){
+                                return 0x17;
+                            }else{
+                                return 0x43;
+                            }
+                        }else{
+                            if(c < U'Ɵ'){
+                                return 0xD4;
+                            }else{
+                                return default_categories_set;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x1,  
+    0x1,  0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
+    0xB,  0xB,  0xB,  0xB,  0x64, 0x64, 0x64, 0x64, 
+    0x64, 0x64, 0x64, 0x64, 0x1,  0x1,  0x8E, 0x8E, 
+    0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0xC1, 0xC1, 0xC1, 
+    0x1,  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
+    0x1,  0x1,  0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 
+    0x6C, 0x1,  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
+    0x38, 0x38, 0x1,  0x1,  0x1,  0x3B, 0x3B, 0x3B, 
+    0x3B, 0x3B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
+    0x4C, 0x4C, 0x1,  0x1,  0x37, 0x37, 0x37, 0x37, 
+    0x37, 0x37, 0x1,  0x1,  0xAD, 0xAD, 0xAD, 0xAD
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0x2F, 0x2F, 0xCF, 0xCF, 0xC7, 0xD7, 0xD7, 0xD7, 0xD7, 0xF3, 0x93, 0x93, 0x9B, 0x9B, 0x93, 0x93, 
+    0x1C, 0x1C, 0x1C, 0x1C, 0x94, 0xC4, 0xC4, 0xC0, 0xC0, 0xD4, 0x14, 0x14, 0x14, 0x14, 0x1C, 0x1C, 
+    0x94, 0x94, 0x34, 0x34, 0xBC, 0xAC, 0xAC, 0xA8, 0xA8, 0x88, 0x48, 0x48, 0xC0, 0xC0, 0xC8, 0xC8, 
+    0xDC, 0xDC, 0x3C, 0x3C, 0x34, 0x64, 0x64, 0x60, 0x60, 0x44, 0x64, 0x64, 0xE4, 0xE4, 0xEC, 0xEC, 
+    0x40, 0x40, 0x0,  0x0,  0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x40, 0x40, 0x20, 0x20, 0xA8, 0xE8, 0xE8, 0xE8, 0xE8, 0xD8, 0x38, 0x38, 0xB0, 0xB0, 0xB0, 0xB0, 
+    0x80, 0x80, 0x20, 0x20, 0x28, 0x38, 0x38, 0x38, 0x28, 0x1C, 0x5C, 0x5C, 0x54, 0x54, 0x54, 0x54, 
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x0,  0x10, 0x10, 0x10, 0x90, 0x90, 0x98, 0x98
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'('},    {U'0', U'3'},    {U'<', U'='},      {U'E', U'Q'},    
+    {U'Y', U'Y'},    {U'b', U'i'},    {U'r',  130},      { 138,  145},    
+    { 153, U'¦'},   {U'«', U'¹'},  {U'Á', U'Á'},    {U'È', U'Ê'},  
+    {U'Ñ', U'Ò'},  {U'Û', U'Ü'},  {U'å', U'ñ'},    {U'ú', U'ú'},  
+    {U'ā', U'ċ'},  {U'đ', U'ĝ'},  {U'Ġ', U'ı'},    {U'Ĺ', U'Ŀ'},  
+    {U'Ņ', U'Ņ'},  {U'ŋ', U'Ř'},  {U'ŝ', U'Ş'},    {U'š', U'Ų'},  
+    {U'Ÿ', U'Ÿ'},  {U'ž', U'Ɩ'},  {U'Ɵ', 1114111},  {  32, U'&'},    
+    {U')', U'3'},    {U'>', U'D'},    {U'I', U'O'},      {U'e', U'i'},    
+    {U't', U'y'},    { 131,  137},    { 155,  158},      {U' ', U'£'},  
+    {U'§', U'ª'},  {U'Ë', U'Ð'},  {U'Ó', U'Ú'},    {U'Ý', U'ä'},  
+    {U'è', U'ï'},  {U'ü', U'Ā'},  {U'Č', U'Đ'},    {U'Ĕ', U'Ĕ'},  
+    {U'Ĳ', U'ĸ'},  {U'ŀ', U'ń'},  {U'Ŕ', U'Ŗ'},    {U'Ś', U'Ŝ'},  
+    {U'š', U'ŧ'},  {U'ž', U'Ɓ'},  {U'ƅ', U'Ǝ'},    {U'Ɠ', U'Ɩ'},  
+    {  32, U'&'},    {U'4', U';'},    {U'>', U'D'},      {U'R', U'X'},    
+    {U'j', U'q'},    {U't', U'y'},    {U'|',  130},      { 140,  152},    
+    {U'§', U'ª'},  {U'³', U'·'},  {U'º', U'½'},    {U'Ý', U'ä'},  
+    {U'è', U'í'},  {U'ò', U'ù'},  {U'ü', U'Ā'},    {U'Ą', U'Ĉ'},  
+    {U'Č', U'Đ'},  {U'Ĕ', U'Ĕ'},  {U'ģ', U'ĩ'},    {U'ī', U'İ'},  
+    {U'Ĳ', U'ĸ'},  {U'Ň', U'Ŋ'},  {U'Ō', U'Ő'},    {U'Œ', U'Œ'},  
+    {U'ŗ', U'Ř'},  {U'Ś', U'Ŝ'},  {U'ş', U'ŧ'},    {U'ū', U'ů'},  
+    {U'ž', U'Ɓ'},  {U'Ɠ', U'Ɠ'},  {U'Ɨ', U'ƞ'},    {  32, U'&'},    
+    {U')', U'3'},    {U'>', U'D'},    {U'R', U'X'},      {U'Z', U'a'},    
+    {U'e', U'q'},    {U'|',  137},    { 155,  158},      {U'§', U'·'},  
+    {U'Â', U'Ç'},  {U'Ó', U'Ú'},  {U'Ý', U'ä'},    {U'î', U'ï'},  
+    {U'ò', U'ù'},  {U'û', U'Ā'},  {U'Ĕ', U'Ĕ'},    {U'ģ', U'ĩ'},  
+    {U'ņ', U'ņ'},  {U'Ō', U'Ő'},  {U'ŗ', U'Ŝ'},    {U'ş', U'ŧ'},  
+    {U'ū', U'ů'},  {U'Ɔ', U'Ǝ'},  {U'Z', U'a'},      {U'e', U'i'},    
+    {U't', U'y'},    { 131,  137},    { 155,  158},      {U' ', U'£'},  
+    {U'«', U'²'},  {U'º', U'À'},  {U'Â', U'Ç'},    {U'Ë', U'Ð'},  
+    {U'Ý', U'ä'},  {U'è', U'í'},  {U'ò', U'ù'},    {U'ü', U'Ā'},  
+    {U'ė', U'Ĝ'},  {U'Ğ', U'ğ'},  {U'ī', U'İ'},    {U'Ĳ', U'ĸ'},  
+    {U'ļ', U'ń'},  {U'ņ', U'ņ'},  {U'Œ', U'Œ'},    {U'ŗ', U'Ř'},  
+    {U'ş', U'Š'},  {U'ų', U'ŷ'},  {U'ž', U'Ɓ'},    {U'Ǝ', U'Ǝ'},  
+    {U'Ɛ', U'Ɛ'},  {U'Ɠ', U'Ɠ'},  {U'Ɨ', U'ƞ'},    {U'4', U';'},    
+    {U'I', U'O'},    {U'R', U'X'},    {U'Z', U'a'},      {U'e', U'i'},    
+    {U't', U'y'},    {U'|',  137},    { 140,  152},      {U' ', U'£'},  
+    {U'§', U'·'},  {U'Ý', U'ä'},  {U'è', U'ï'},    {U'ò', U'ù'},  
+    {U'û', U'û'},  {U'ā', U'ā'},  {U'Ą', U'Ĉ'},    {U'Ĕ', U'Ĕ'},  
+    {U'ī', U'İ'},  {U'ļ', U'ń'},  {U'Ň', U'Ŋ'},    {U'Ō', U'Ő'},  
+    {U'ŗ', U'ř'},  {U'ş', U'ŧ'},  {U'ū', U'ů'},    {U'ų', U'ŷ'},  
+    {U'ž', U'Ɓ'},  {U')', U'/'},    {U'4', U';'},      {U'E', U'G'},    
+    {U'I', U'O'},    {U'R', U'X'},    {U'j', U'q'},      { 131,  137},    
+    {U' ', U'£'},  {U'«', U'²'},  {U'¾', U'À'},    {U'Â', U'Ç'},  
+    {U'Ó', U'Ú'},  {U'Ý', U'ä'},  {U'è', U'í'},    {U'û', U'û'},  
+    {U'Ą', U'Ĉ'},  {U'Č', U'Đ'},  {U'Ĕ', U'Ĕ'},    {U'ė', U'Ĝ'},  
+    {U'Ğ', U'ğ'},  {U'ģ', U'ĩ'},  {U'ī', U'İ'},    {U'ļ', U'Ŀ'},  
+    {U'Ō', U'Ő'},  {U'Œ', U'Œ'},  {U'Ŕ', U'Ŗ'},    {U'ř', U'ř'},  
+    {U'š', U'ŧ'},  {U'ū', U'ů'},  {U'ų', U'ŷ'},    {U'Ź', U'Ž'},  
+    {U'Ɛ', U'Ɛ'},  {U'Ɣ', U'ƞ'},  {  32, U'&'},      {U'>', U'G'},    
+    {U'I', U'O'},    {U'|',  130},    { 140,  152},      {U' ', U'£'},  
+    {U'¾', U'À'},  {U'Ó', U'Ú'},  {U'Ý', U'ä'},    {U'è', U'ï'},  
+    {U'ò', U'ù'},  {U'û', U'û'},  {U'ā', U'ā'},    {U'Ą', U'Ĉ'},  
+    {U'Ĕ', U'Ĕ'},  {U'Ğ', U'ğ'},  {U'ŀ', U'ń'},    {U'ŗ', U'Ŝ'},  
+    {U'š', U'ŧ'},  {U'ū', U'ů'},  {U'ƅ', U'ƅ'},    {U'Ɨ', U'ƞ'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,    27,  52,  83,  106,  135,  161,  194,  
+    216
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1113952,  146,  176,  169,  144,  171,  171,  125
+};
+
+} // namespace synthetic_unrolled_64
+
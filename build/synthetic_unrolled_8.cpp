@@ -0,0 +1,116 @@
+#include "synthetic_unrolled_8.h"
+
+namespace synthetic_unrolled_8{
+Categories_set get_categories_set(char32_t c){
+    if(c < U'7'){
+        if(c < U')'){
+            if(c < U'#'){
+                return default_categories_set;
+            }else{
+                if(c < U'('){
+                    return 0x25;
+                }else{
+                    return default_categories_set;
+                }
+            }
+        }else{
+            if(c < U'3'){
+                if(c < U'/'){
+                    return 0xD4;
+                }else{
+                    return 0x4E;
+                }
+            }else{
+                if(c < U'6'){
+                    return default_categories_set;
+                }else{
+                    return 0xF0;
+                }
+            }
+        }
+    }else{
+        if(c < U'C'){
+            if(c < U'='){
+                if(c < U'8'){
+                    return default_categories_set;
+                }else{
+                    return 0x99;
+                }
+            }else{
+                if(c < U'@'){
+                    return default_categories_set;
+                }else{
+                    return 0xEF;
+                }
+            }
+        }else{
+            if(c < U'J'){
+                if(c < U'I'){
+                    return 0x1C;
+                }else{
+                    return default_categories_set;
+                }
+            }else{
+                if(c < U'R'){
+                    return 0xFE;
+                }else{
+                    return default_categories_set;
+                }
+            }
+        }
+    }
+}
+
+extern const Categories_set direct_categories_table[] = {
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x25, 0x25, 0x25, 0x25, 0x25, 
+    0x1,  0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0x4E, 
+    0x4E, 0x4E, 0x4E, 0x1,  0x1,  0x1,  0xF0, 0x1,  
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x1,  0x1,  0x1,  
+    0xEF, 0xEF, 0xEF, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 
+    0x1C, 0x1,  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 
+    0xFE, 0xFE, 0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  
+    0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1,  0x1
+};
+
+extern const uint8_t direct_category_nibbles[] = {
+    0xD7, 0xD7, 0xF7, 0xEF, 0xEF, 0xEF, 0xE7, 0xEF, 0xEF, 0xFB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 
+    0x38, 0x38, 0x18, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 
+    0x38, 0x38, 0x18, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x4,  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+    0x38, 0x38, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x8,  0x18, 0x18, 0x18, 0x10, 0x10, 0x14, 
+    0x20, 0x20, 0x0,  0x10, 0x10, 0x10, 0x18, 0x10, 0x18, 0xC,  0x1C, 0x1C, 0x1C, 0x14, 0x14, 0x10, 
+    0x30, 0x30, 0x10, 0x4,  0x4,  0x4,  0xC,  0x4,  0x0,  0x0,  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
+    0x38, 0x38, 0x18, 0x0,  0x0,  0x0,  0x8,  0x0,  0x0,  0x4,  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
+    0x30, 0x30, 0x10, 0x0,  0x0,  0x0,  0x8,  0x0,  0x8,  0xC,  0x1C, 0x1C, 0x1C, 0x14, 0x14, 0x10
+};
+
+extern const Segment<char32_t> category_ranges[] = {
+    {   0, U'('},     {U'3', U'5'},   {U'7', U'B'},  {U'I', U'I'},  
+    {U'R', 1114111},  {U'/', U'2'},   {U'@', U'B'},  {U'J', U'Q'},  
+    {U'#', U'\''},    {U')', U'2'},   {U'@', U'H'},  {U'J', U'Q'},  
+    {U'/', U'2'},     {U'8', U'<'},   {U'@', U'H'},  {U'J', U'Q'},  
+    {U')', U'.'},     {U'6', U'6'},   {U'8', U'<'},  {U'C', U'H'},  
+    {U'J', U'Q'},     {U'#', U'\''},  {U'6', U'6'},  {U'@', U'B'},  
+    {U'J', U'Q'},     {U')', U'2'},   {U'6', U'6'},  {U'@', U'B'},  
+    {U'J', U'Q'},     {U')', U'.'},   {U'6', U'6'},  {U'8', U'<'},  
+    {U'@', U'B'},     {U'J', U'Q'}
+};
+
+extern const size_t category_ranges_offsets[] = {
+    0,   5,  8,  12,  16,  21,  25,  29,  
+    34
+};
+
+extern const size_t num_of_chars_in_category[] = {
+    1114087,  15,  32,  26,  26,  17,  22,  23
+};
+
+} // namespace synthetic_unrolled_8
+
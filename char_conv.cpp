@@ -29,7 +29,7 @@ std::string char32_to_utf8(const char32_t c){
             temp >>= 6;
             c2 = 0b10'00'0000 | (temp & 0b111'111);
             temp >>= 6;
-            c1 = 0b1110'0000 | c;
+            c1 = 0b1110'0000 | temp;
             s += c1; s += c2; s += c3;
             break;
             
@@ -40,7 +40,7 @@ std::string char32_to_utf8(const char32_t c){
             temp >>= 6;
             c2 = 0b10'00'0000 | (temp & 0b111'111);
             temp >>= 6;
-            c1 = 0b11110'000 | c;
+            c1 = 0b11110'000 | temp;
             s += c1; s += c2; s += c3; s += c4;
             break;
             
@@ -109,3 +109,46 @@ std::u32string utf8_to_u32string(const char* utf8str){
     return s;
 }
 
+static const char32_t replacement_char = 0xFFFD;
+static const char32_t max_char         = 0x10FFFF;
+
+/* The least characters encoded by 2, 3 and 4 bytes; shorter encodings are overlong. */
+static const char32_t min_char_of_len[] = {0, 0, 0x80, 0x800, 0x10000};
+
+char32_t utf8_to_char32(const char*& p, const char* end){
+    unsigned char b = static_cast<unsigned char>(*p);
+    if(b < 0x80){
+        p++;
+        return b;
+    }
+    size_t   len;
+    char32_t c;
+    if((b >= 0xC2) && (b <= 0xDF)){
+        len = 2; c = b & 0b0001'1111;
+    }else if((b & 0b1111'0000) == 0b1110'0000){
+        len = 3; c = b & 0b0000'1111;
+    }else if((b >= 0xF0) && (b <= 0xF4)){
+        len = 4; c = b & 0b0000'0111;
+    }else{
+        p++;
+        return replacement_char;
+    }
+    if(static_cast<size_t>(end - p) < len){
+        p++;
+        return replacement_char;
+    }
+    for(size_t i = 1; i < len; i++){
+        unsigned char cont = static_cast<unsigned char>(p[i]);
+        if((cont & 0b1100'0000) != 0b1000'0000){
+            p++;
+            return replacement_char;
+        }
+        c = (c << 6) | (cont & 0b0011'1111);
+    }
+    if((c < min_char_of_len[len]) || ((c >= 0xD800) && (c <= 0xDFFF)) || (c > max_char)){
+        p++;
+        return replacement_char;
+    }
+    p += len;
+    return c;
+}
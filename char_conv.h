@@ -52,4 +52,19 @@ std::string u32string_to_utf8(const std::u32string& u32str);
 тот же символ, но в кодировке UTF-8.
 */
 std::string char32_to_utf8(const char32_t c);
+
+/**
+\function utf8_to_char32
+Декодирует один символ в кодировке UTF-8, начинающийся с байта *p, и перемещает p
+на байт, следующий за этим символом. Байты, не образующие корректного символа,
+декодируются как U+FFFD, по одному байту за раз. Некорректными считаются также
+избыточно длинные (overlong) последовательности, суррогаты U+D800--U+DFFF и значения,
+большие U+10FFFF.
+
+\param [in, out] p   - указатель на первый байт символа
+\param [in]      end - указатель на байт, следующий за концом текста; p < end
+
+\return Значение типа char32_t: декодированный символ.
+*/
+char32_t utf8_to_char32(const char*& p, const char* end);
 #endif
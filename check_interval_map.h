@@ -0,0 +1,193 @@
+/*
+     Файл:    check_interval_map.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef CHECK_INTERVAL_MAP_H
+#define CHECK_INTERVAL_MAP_H
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include "interval_map.h"
+/*
+ * Brute-force check of Interval_map: random operations insert, erase, complement, |= and
+ * &= are applied both to Interval_map<K, uint64_t> and to the array of values of all keys,
+ * and after each operation get() must agree with the array for all keys. The segments of
+ * the map must be sorted, disjoint, with non-empty values, and adjacent segments must have
+ * distinct values. The key type K should be small, e.g. uint8_t or uint16_t, so that the
+ * operations at the largest key are checked too.
+*/
+template<Integral K>
+class Interval_map_check{
+public:
+    explicit Interval_map_check(unsigned seed) : gen(seed) {}
+
+    /* Returns the number of operations after which the map differs from the array. */
+    size_t run(size_t num_of_operations);
+private:
+    using Map    = Interval_map<K, uint64_t>;
+    using Values = std::vector<uint64_t>;
+
+    static const size_t num_of_keys = static_cast<size_t>(std::numeric_limits<K>::max()) + 1;
+    static const uint64_t default_value = 1ULL << 63;
+
+    std::mt19937 gen;
+
+    Segment<K> random_segment();
+    uint64_t   random_mask();
+    void       random_map(Map& m, Values& v);
+
+    static bool agree(const Map& m, const Values& v);
+};
+
+template<Integral K>
+const size_t Interval_map_check<K>::num_of_keys;
+
+template<Integral K>
+const uint64_t Interval_map_check<K>::default_value;
+
+template<Integral K>
+Segment<K> Interval_map_check<K>::random_segment(){
+    std::uniform_int_distribution<size_t> key(0, num_of_keys - 1);
+    std::uniform_int_distribution<size_t> len(0, 16);
+    size_t lower = key(gen);
+    /* Short segments are more frequent, and some segments end at the largest key. */
+    size_t upper = (gen() & 1) ? std::min(lower + len(gen), num_of_keys - 1) :
+                                 std::max(lower, key(gen));
+    return Segment<K>(static_cast<K>(lower), static_cast<K>(upper));
+}
+
+template<Integral K>
+uint64_t Interval_map_check<K>::random_mask(){
+    return 1ULL << (gen() % 4) | ((gen() & 3) ? 0 : 1ULL << (gen() % 4));
+}
+
+template<Integral K>
+void Interval_map_check<K>::random_map(Map& m, Values& v){
+    m = Map(default_value);
+    v.assign(num_of_keys, 0);
+    for(size_t i = 0; i < 8; i++){
+        auto     s    = random_segment();
+        uint64_t mask = random_mask();
+        m.insert(s, mask);
+        for(size_t k = s.lower_bound; k <= s.upper_bound; k++){
+            v[k] |= mask;
+        }
+    }
+}
+
+template<Integral K>
+bool Interval_map_check<K>::agree(const Map& m, const Values& v){
+    for(size_t k = 0; k < num_of_keys; k++){
+        uint64_t expected = v[k] ? v[k] : default_value;
+        if(m.get(static_cast<K>(k)) != expected){
+            return false;
+        }
+    }
+    auto segments = m.segments();
+    if(segments.size() != m.num_of_segments()){
+        return false;
+    }
+    size_t num_of_keys_in_segments = 0;
+    for(size_t i = 0; i < segments.size(); i++){
+        const auto& s = segments[i];
+        if((s.bounds.lower_bound > s.bounds.upper_bound) || !s.value){
+            return false;
+        }
+        if(i && (segments[i - 1].bounds.upper_bound >= s.bounds.lower_bound)){
+            return false;
+        }
+        if(i && (segments[i - 1].bounds.upper_bound + 1 == s.bounds.lower_bound) &&
+           (segments[i - 1].value == s.value))
+        {
+            return false;
+        }
+        for(size_t k = s.bounds.lower_bound; k <= s.bounds.upper_bound; k++){
+            if(v[k] != s.value){
+                return false;
+            }
+        }
+        num_of_keys_in_segments += s.bounds.upper_bound - s.bounds.lower_bound + 1;
+    }
+    size_t num_of_nonempty_keys = 0;
+    for(uint64_t x : v){
+        num_of_nonempty_keys += (x != 0);
+    }
+    return num_of_keys_in_segments == num_of_nonempty_keys;
+}
+
+template<Integral K>
+size_t Interval_map_check<K>::run(size_t num_of_operations){
+    Map    m;
+    Values v;
+    Map    rhs;
+    Values rhs_v;
+    size_t num_of_errors = 0;
+    random_map(m, v);
+    for(size_t i = 0; i < num_of_operations; i++){
+        auto     s    = random_segment();
+        uint64_t mask = random_mask();
+        switch(gen() % 6){
+            case 0:
+                m.insert(s, mask);
+                for(size_t k = s.lower_bound; k <= s.upper_bound; k++){
+                    v[k] |= mask;
+                }
+                break;
+            case 1:
+                m.erase(s, mask);
+                for(size_t k = s.lower_bound; k <= s.upper_bound; k++){
+                    v[k] &= ~mask;
+                }
+                break;
+            case 2:
+                m.erase(s);
+                for(size_t k = s.lower_bound; k <= s.upper_bound; k++){
+                    v[k] = 0;
+                }
+                break;
+            case 3:
+                m.complement(s, mask);
+                for(size_t k = s.lower_bound; k <= s.upper_bound; k++){
+                    v[k] ^= mask;
+                }
+                break;
+            case 4:
+                random_map(rhs, rhs_v);
+                m |= rhs;
+                for(size_t k = 0; k < num_of_keys; k++){
+                    v[k] |= rhs_v[k];
+                }
+                break;
+            default:
+                random_map(rhs, rhs_v);
+                m &= rhs;
+                for(size_t k = 0; k < num_of_keys; k++){
+                    v[k] &= rhs_v[k];
+                }
+        }
+        if(!agree(m, v)){
+            num_of_errors++;
+            /* Continue from a correct map, so that one error isn't counted many times. */
+            random_map(m, v);
+        }
+        if(!(gen() % 16)){
+            /* The map can become almost empty after &=; then it is refilled. */
+            Map    extra;
+            Values extra_v;
+            random_map(extra, extra_v);
+            m |= extra;
+            for(size_t k = 0; k < num_of_keys; k++){
+                v[k] |= extra_v[k];
+            }
+        }
+    }
+    return num_of_errors;
+}
+#endif
@@ -0,0 +1,72 @@
+/*
+     Файл:    classification_table.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef CLASSIFICATION_TABLE_H
+#define CLASSIFICATION_TABLE_H
+#include "myconcepts.h"
+#include "segment.h"
+#include "knuth_find.h"
+#include "knuth_layout.h"
+#include "interval_map.h"
+/*
+ * Immutable classification table loaded at runtime: segments permuted for knuth_find,
+ * as in the generated code. The table can be built either from a generated table or
+ * from Interval_map. Since the table is never modified, it can be read by any number
+ * of threads.
+*/
+template<Integral K, typename V>
+class Classification_table{
+public:
+    /* Copies a table that is already permuted for knuth_find, e.g. a generated one. */
+    template<RandomAccessIterator I>
+    Classification_table(I it_begin, I it_end, V default_value);
+
+    explicit Classification_table(const Interval_map<K, V>& m);
+
+    Classification_table(const Classification_table&) = default;
+    ~Classification_table()                           = default;
+
+    V get(K key) const;
+private:
+    SegmentsV<K, V> table;
+    K               max_key = 0;
+    V               default_value;
+};
+
+template<Integral K, typename V>
+template<RandomAccessIterator I>
+Classification_table<K, V>::Classification_table(I it_begin, I it_end, V default_value) :
+    default_value(default_value)
+{
+    for(I it = it_begin; it != it_end; ++it){
+        Segment<K> bounds(it->bounds.lower_bound, it->bounds.upper_bound);
+        table.push_back(Segment_with_value<K, V>(bounds, it->value));
+        if(bounds.upper_bound > max_key){
+            max_key = bounds.upper_bound;
+        }
+    }
+}
+
+template<Integral K, typename V>
+Classification_table<K, V>::Classification_table(const Interval_map<K, V>& m) :
+    default_value(m.get_default_value())
+{
+    auto sorted = m.segments();
+    max_key     = sorted.empty() ? K() : sorted.back().bounds.upper_bound;
+    table       = knuth_layout(sorted);
+}
+
+template<Integral K, typename V>
+V Classification_table<K, V>::get(K key) const{
+    if(table.empty() || (key > max_key)){
+        return default_value;
+    }
+    auto t = knuth_find(table.begin(), table.end(), key);
+    return t.first ? table[t.second].value : default_value;
+}
+#endif
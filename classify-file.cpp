@@ -0,0 +1,86 @@
+/*
+     Файл:    classify-file.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+/*
+ * Classifies all characters of a file in the encoding UTF-8 by the table generated by
+ * table-gen-for-expr, in parallel, and prints the number of characters in each category
+ * and the throughput.
+*/
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <chrono>
+#include <thread>
+#include "categories_table.h"
+#include "mapped_file.h"
+#include "classify_chunks.h"
+
+static const size_t default_chunk_size = 1 << 20;
+
+static const char* threads_option    = "--threads=";
+static const char* chunk_size_option = "--chunk-size=";
+
+static void usage(const char* program_name){
+    fprintf(stderr,
+            "Usage: %s [--threads=N] [--chunk-size=BYTES] file\n"
+            "By default N is the number of hardware threads, and BYTES is %zu.\n",
+            program_name, default_chunk_size);
+}
+
+int main(int argc, char* argv[]){
+    size_t      num_of_threads = std::thread::hardware_concurrency();
+    size_t      chunk_size     = default_chunk_size;
+    const char* file_name      = nullptr;
+    for(int i = 1; i < argc; i++){
+        const char* arg = argv[i];
+        if(!strncmp(arg, threads_option, strlen(threads_option))){
+            num_of_threads = strtoul(arg + strlen(threads_option), nullptr, 10);
+        }else if(!strncmp(arg, chunk_size_option, strlen(chunk_size_option))){
+            chunk_size = strtoul(arg + strlen(chunk_size_option), nullptr, 10);
+        }else if(!file_name && (arg[0] != '-')){
+            file_name = arg;
+        }else{
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(!file_name || !num_of_threads || !chunk_size){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Mapped_file f;
+    if(!f.open(file_name)){
+        fprintf(stderr, "Can't open the file %s: %s\n", file_name, strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    auto classify = [](char32_t c){return get_categories_set(c);};
+    auto t0       = std::chrono::steady_clock::now();
+    auto chunks   = classify_chunks<Categories_set>(f.begin(), f.end(), classify,
+                                                    chunk_size, num_of_threads);
+    auto t1       = std::chrono::steady_clock::now();
+    auto total    = aggregate(chunks);
+
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+    for(size_t k = 0; k < max_num_of_categories; k++){
+        if(total.num_of_chars_in_category[k]){
+            printf("category %2zu: %zu\n", k, total.num_of_chars_in_category[k]);
+        }
+    }
+    printf("characters: %zu\nbytes:      %zu\nchunks:     %zu\nthreads:    %zu\n",
+           total.num_of_chars, total.num_of_bytes, chunks.size(), num_of_threads);
+    printf("time:       %.3f s\nthroughput: %.1f MB/s, %.1f Mchars/s\n", seconds,
+           seconds > 0 ? total.num_of_bytes / seconds / 1e6 : 0.0,
+           seconds > 0 ? total.num_of_chars / seconds / 1e6 : 0.0);
+    return 0;
+}
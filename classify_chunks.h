@@ -0,0 +1,102 @@
+/*
+     Файл:    classify_chunks.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef CLASSIFY_CHUNKS_H
+#define CLASSIFY_CHUNKS_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "myconcepts.h"
+#include "char_conv.h"
+#include "utf8_chunks.h"
+#include "work_stealing_pool.h"
+/*
+ * Parallel classification of a text in the encoding UTF-8. The text is split into
+ * chunks on boundaries of characters, and the chunks are classified by the pool of
+ * threads from work_stealing_pool.h. The type Set is an unsigned integer type of sets
+ * of categories, e.g. Categories_set of the generated table, and classify is a function
+ * like the generated get_categories_set.
+*/
+static const size_t max_num_of_categories = 64;
+
+template<typename Set>
+struct Chunk_classification{
+    /* Sets of categories of all characters of the chunk, if they were requested. */
+    std::vector<Set> categories;
+    /* num_of_chars_in_category[k] is the number of characters with the category k. */
+    size_t           num_of_chars_in_category[max_num_of_categories] = {};
+    size_t           num_of_chars                                    = 0;
+    size_t           num_of_bytes                                    = 0;
+};
+
+template<typename Set, Callable F>
+void classify_chunk(const Chunk& chunk, F classify, bool keep_categories,
+                    Chunk_classification<Set>& result)
+{
+    /* Counters are local, so that threads don't share cache lines while counting. */
+    size_t      counters[max_num_of_categories] = {};
+    size_t      num_of_chars                    = 0;
+    const char* p                               = chunk.begin;
+    if(keep_categories){
+        result.categories.reserve(chunk.end - chunk.begin);
+    }
+    while(p != chunk.end){
+        char32_t c   = utf8_to_char32(p, chunk.end);
+        Set      set = classify(c);
+        if(keep_categories){
+            result.categories.push_back(set);
+        }
+        for(uint64_t bits = set; bits; bits &= bits - 1){
+            counters[__builtin_ctzll(bits)]++;
+        }
+        num_of_chars++;
+    }
+    for(size_t k = 0; k < max_num_of_categories; k++){
+        result.num_of_chars_in_category[k] = counters[k];
+    }
+    result.num_of_chars = num_of_chars;
+    result.num_of_bytes = chunk.end - chunk.begin;
+}
+
+/**
+ * \param [in] begin, end       text in the encoding UTF-8
+ * \param [in] classify         function returning the set of categories of a character
+ * \param [in] chunk_size       approximate size of a chunk in bytes
+ * \param [in] num_of_threads   number of threads
+ * \param [in] keep_categories  whether to keep the sets of categories of all characters
+ *
+ * \return results of classification of the chunks, in the order of the chunks in the text
+ */
+template<typename Set, Callable F>
+std::vector<Chunk_classification<Set>> classify_chunks(const char* begin, const char* end,
+                                                       F classify, size_t chunk_size,
+                                                       size_t num_of_threads,
+                                                       bool keep_categories = false)
+{
+    auto chunks = split_utf8_into_chunks(begin, end, chunk_size);
+    auto result = std::vector<Chunk_classification<Set>>(chunks.size());
+    run_tasks(chunks.size(), num_of_threads, [&](size_t i){
+        classify_chunk(chunks[i], classify, keep_categories, result[i]);
+    });
+    return result;
+}
+
+/* Sum of statistics of all chunks; the sets of categories are not copied. */
+template<typename Set>
+Chunk_classification<Set> aggregate(const std::vector<Chunk_classification<Set>>& chunks){
+    Chunk_classification<Set> result;
+    for(const auto& c : chunks){
+        for(size_t k = 0; k < max_num_of_categories; k++){
+            result.num_of_chars_in_category[k] += c.num_of_chars_in_category[k];
+        }
+        result.num_of_chars += c.num_of_chars;
+        result.num_of_bytes += c.num_of_bytes;
+    }
+    return result;
+}
+#endif
@@ -0,0 +1,53 @@
+/*
+     Файл:    fused_tables.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include "fused_tables.h"
+
+static const size_t bits_in_word = 64;
+
+static void add_shifted(Multiword_mask& dest, const Multiword_mask& src, size_t offset){
+    size_t n = src.num_of_significant_bits();
+    for(size_t k = 0; k < n; k++){
+        if(src.test(k)){
+            dest.set_bit(k + offset);
+        }
+    }
+}
+
+bool fuse_tables(const std::vector<Table_spec>& specs, Fused_tables& result){
+    size_t offset = 0;
+    for(const auto& spec : specs){
+        size_t width = spec.category_names.size();
+        if(width > bits_in_word){
+            return false;
+        }
+        if(offset / bits_in_word != (offset + width - 1) / bits_in_word){
+            offset = (offset / bits_in_word + 1) * bits_in_word;
+        }
+        result.offsets.push_back(offset);
+        offset += width;
+    }
+
+    size_t num_of_specs = specs.size();
+    for(size_t i = 0; i < num_of_specs; i++){
+        add_shifted(result.default_set, default_set_of(specs[i]), result.offsets[i]);
+        for(const auto& e : specs[i].table){
+            result.table[e.first];
+        }
+    }
+    /* Now result.table contains all characters of all tables, and the values can be built. */
+    for(auto& e : result.table){
+        for(size_t i = 0; i < num_of_specs; i++){
+            const auto& t  = specs[i].table;
+            auto        it = t.find(e.first);
+            add_shifted(e.second, (it != t.end()) ? it->second : default_set_of(specs[i]),
+                        result.offsets[i]);
+        }
+    }
+    return true;
+}
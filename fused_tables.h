@@ -0,0 +1,31 @@
+/*
+     Файл:    fused_tables.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef FUSED_TABLES_H
+#define FUSED_TABLES_H
+#include <cstddef>
+#include <map>
+#include <vector>
+#include "multiword_mask.h"
+#include "table_specs.h"
+/*
+ * Several tables merged into one: the segments of the merged table form the common
+ * refinement of the segments of all tables, and its values are the sets of categories of
+ * all tables packed together. The set of categories of the i-th table occupies the bits
+ * from offsets[i] up to offsets[i] + number of its categories - 1; these bits never cross
+ * a boundary of a 64-bit word.
+*/
+struct Fused_tables{
+    std::map<char32_t, Multiword_mask> table;
+    Multiword_mask                     default_set;
+    std::vector<size_t>                offsets;
+};
+
+/* Returns false if some table has more than 64 categories. */
+bool fuse_tables(const std::vector<Table_spec>& specs, Fused_tables& result);
+#endif
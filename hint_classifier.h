@@ -0,0 +1,23 @@
+/*
+     Файл:    hint_classifier.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef HINT_CLASSIFIER_H
+#define HINT_CLASSIFIER_H
+#include <string>
+#include "table_types.h"
+/**
+ * \param [in] tt  types of the generated table
+ *
+ * \return text of the class Classifier, which remembers the element of the table found
+ *         by the previous lookup. The next character is looked for first in this element
+ *         and in its neighbour (in the order of characters) in the direction of the
+ *         character, and only then by knuth_find from the root. The numbers of lookups
+ *         and of hits of the hint are counted.
+ */
+std::string hint_classifier_class(const Table_types& tt);
+#endif
@@ -0,0 +1,241 @@
+/*
+     Файл:    interval_map.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef INTERVAL_MAP_H
+#define INTERVAL_MAP_H
+#include <map>
+#include <limits>
+#include <iterator>
+#include "myconcepts.h"
+#include "segment.h"
+#include "knuth_find.h"
+#include "knuth_layout.h"
+/*
+ * Runtime counterpart of the generated classification table: a mutable map from
+ * characters to sets of categories. The type V is an unsigned integer type, whose
+ * bits are categories; the value V() means an empty set.
+ *
+ * The map is stored as a sequence of runs: the value runs[k] belongs to all keys from
+ * k up to the next key of runs minus one. Adjacent runs always have distinct values.
+ * Each modification costs O(log n + k), where k is the number of affected runs.
+ *
+ * Lookups use the same table as the generated code, i.e. the segments permuted for
+ * knuth_find. This table is rebuilt lazily, in linear time, by the first lookup after
+ * a modification. Since get() can rebuild the table, call rebuild() before sharing the
+ * map between threads.
+*/
+template<Integral K, typename V>
+class Interval_map{
+public:
+    explicit Interval_map(V default_value = V());
+    Interval_map(const Interval_map&) = default;
+    ~Interval_map()                   = default;
+
+    Interval_map& operator = (const Interval_map&) = default;
+
+    /* Builds the map from segments with values, e.g. from a generated table. */
+    template<RandomAccessIterator I>
+    Interval_map(I it_begin, I it_end, V default_value = V());
+
+    /* Adds the categories from mask to all characters of the segment s. */
+    void insert(Segment<K> s, V mask);
+    /* Removes the categories from mask from all characters of the segment s. */
+    void erase(Segment<K> s, V mask);
+    /* Removes all categories from all characters of the segment s. */
+    void erase(Segment<K> s);
+    /* Toggles the categories from mask for all characters of the segment s. */
+    void complement(Segment<K> s, V mask);
+
+    /* Set-wise union and intersection of the values for each character. */
+    Interval_map& operator |= (const Interval_map& rhs);
+    Interval_map& operator &= (const Interval_map& rhs);
+
+    /* Set of categories of the character key, or default value if the set is empty. */
+    V get(K key) const;
+
+    /* Sorted segments with non-empty values. */
+    SegmentsV<K, V> segments() const;
+
+    void rebuild() const;
+
+    size_t num_of_segments() const;
+
+    V get_default_value() const {return default_value;}
+private:
+    using Runs = std::map<K, V>;
+
+    Runs                    runs;
+    V                       default_value;
+
+    mutable SegmentsV<K, V> table;
+    mutable K               max_key  = 0;
+    mutable bool            is_dirty = true;
+
+    typename Runs::iterator split(K key);
+
+    template<Callable F>
+    void apply(Segment<K> s, F f);
+
+    template<Callable F>
+    void combine(const Interval_map& rhs, F f);
+};
+
+template<Integral K, typename V>
+Interval_map<K, V>::Interval_map(V default_value) : default_value(default_value)
+{
+    runs[std::numeric_limits<K>::min()] = V();
+}
+
+template<Integral K, typename V>
+template<RandomAccessIterator I>
+Interval_map<K, V>::Interval_map(I it_begin, I it_end, V default_value) :
+    Interval_map(default_value)
+{
+    for(I it = it_begin; it != it_end; ++it){
+        insert(it->bounds, it->value);
+    }
+}
+
+template<Integral K, typename V>
+typename Interval_map<K, V>::Runs::iterator Interval_map<K, V>::split(K key){
+    auto it = std::prev(runs.upper_bound(key));
+    if(it->first == key){
+        return it;
+    }
+    return runs.emplace_hint(std::next(it), key, it->second);
+}
+
+template<Integral K, typename V>
+template<Callable F>
+void Interval_map<K, V>::apply(Segment<K> s, F f){
+    if(s.lower_bound > s.upper_bound){
+        return;
+    }
+    auto first = split(s.lower_bound);
+    auto last  = (s.upper_bound == std::numeric_limits<K>::max()) ?
+                 runs.end() : split(s.upper_bound + 1);
+    for(auto it = first; it != last; ++it){
+        it->second = f(it->second);
+    }
+    /* Merging of equal adjacent runs, from the run before s up to the run after s. */
+    auto it   = (first == runs.begin()) ? first : std::prev(first);
+    auto stop = (last == runs.end()) ? last : std::next(last);
+    for(auto next = std::next(it); next != stop; next = std::next(it)){
+        if(next->second == it->second){
+            runs.erase(next);
+        }else{
+            it = next;
+        }
+    }
+    is_dirty = true;
+}
+
+template<Integral K, typename V>
+template<Callable F>
+void Interval_map<K, V>::combine(const Interval_map& rhs, F f){
+    Runs result;
+    auto a  = runs.begin();
+    auto b  = rhs.runs.begin();
+    V    va = V();
+    V    vb = V();
+    while((a != runs.end()) || (b != rhs.runs.end())){
+        K key;
+        if((b == rhs.runs.end()) || ((a != runs.end()) && (a->first <= b->first))){
+            key = a->first;
+        }else{
+            key = b->first;
+        }
+        if((a != runs.end()) && (a->first == key)){
+            va = a->second; ++a;
+        }
+        if((b != rhs.runs.end()) && (b->first == key)){
+            vb = b->second; ++b;
+        }
+        V v = f(va, vb);
+        if(result.empty() || (std::prev(result.end())->second != v)){
+            result.emplace_hint(result.end(), key, v);
+        }
+    }
+    runs.swap(result);
+    is_dirty = true;
+}
+
+template<Integral K, typename V>
+void Interval_map<K, V>::insert(Segment<K> s, V mask){
+    apply(s, [mask](V v) -> V{return v | mask;});
+}
+
+template<Integral K, typename V>
+void Interval_map<K, V>::erase(Segment<K> s, V mask){
+    apply(s, [mask](V v) -> V{return v & static_cast<V>(~mask);});
+}
+
+template<Integral K, typename V>
+void Interval_map<K, V>::erase(Segment<K> s){
+    apply(s, [](V) -> V{return V();});
+}
+
+template<Integral K, typename V>
+void Interval_map<K, V>::complement(Segment<K> s, V mask){
+    apply(s, [mask](V v) -> V{return v ^ mask;});
+}
+
+template<Integral K, typename V>
+Interval_map<K, V>& Interval_map<K, V>::operator |= (const Interval_map& rhs){
+    combine(rhs, [](V a, V b) -> V{return a | b;});
+    return *this;
+}
+
+template<Integral K, typename V>
+Interval_map<K, V>& Interval_map<K, V>::operator &= (const Interval_map& rhs){
+    combine(rhs, [](V a, V b) -> V{return a & b;});
+    return *this;
+}
+
+template<Integral K, typename V>
+SegmentsV<K, V> Interval_map<K, V>::segments() const{
+    SegmentsV<K, V> result;
+    for(auto it = runs.begin(); it != runs.end(); ++it){
+        if(it->second == V()){
+            continue;
+        }
+        auto next  = std::next(it);
+        K    upper = (next == runs.end()) ? std::numeric_limits<K>::max() : next->first - 1;
+        result.push_back(Segment_with_value<K, V>(Segment<K>(it->first, upper), it->second));
+    }
+    return result;
+}
+
+template<Integral K, typename V>
+void Interval_map<K, V>::rebuild() const{
+    SegmentsV<K, V> sorted = segments();
+    max_key  = sorted.empty() ? K() : sorted.back().bounds.upper_bound;
+    table    = knuth_layout(sorted);
+    is_dirty = false;
+}
+
+template<Integral K, typename V>
+V Interval_map<K, V>::get(K key) const{
+    if(is_dirty){
+        rebuild();
+    }
+    if(table.empty() || (key > max_key)){
+        return default_value;
+    }
+    auto t = knuth_find(table.begin(), table.end(), key);
+    return t.first ? table[t.second].value : default_value;
+}
+
+template<Integral K, typename V>
+size_t Interval_map<K, V>::num_of_segments() const{
+    if(is_dirty){
+        rebuild();
+    }
+    return table.size();
+}
+#endif
@@ -0,0 +1,30 @@
+/*
+     Файл:    intervals.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include "intervals.h"
+
+std::vector<Interval> segments_to_intervals(const SegmentsV<char32_t, Multiword_mask>& s,
+                                            const Multiword_mask& default_set)
+{
+    std::vector<Interval> result;
+    auto add = [&result](char32_t lower_bound, const Multiword_mask& value){
+        if(result.empty() || (result.back().value != value)){
+            result.push_back(Interval{lower_bound, value});
+        }
+    };
+    char32_t next_char = 0;
+    for(const auto& e : s){
+        if(e.bounds.lower_bound > next_char){
+            add(next_char, default_set);
+        }
+        add(e.bounds.lower_bound, e.value);
+        next_char = e.bounds.upper_bound + 1;
+    }
+    add(next_char, default_set);
+    return result;
+}
@@ -0,0 +1,28 @@
+/*
+     Файл:    intervals.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef INTERVALS_H
+#define INTERVALS_H
+#include <vector>
+#include "segment.h"
+#include "multiword_mask.h"
+
+/* Interval of characters from lower_bound up to the lower bound of the next interval. */
+struct Interval{
+    char32_t       lower_bound;
+    Multiword_mask value;
+};
+
+/*
+ * Splits all characters into intervals: the segments and the gaps between them, whose
+ * value is default_set. The first interval begins with zero, the last one is unbounded,
+ * and adjacent intervals have distinct values.
+*/
+std::vector<Interval> segments_to_intervals(const SegmentsV<char32_t, Multiword_mask>& s,
+                                            const Multiword_mask& default_set);
+#endif
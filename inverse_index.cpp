@@ -0,0 +1,109 @@
+/*
+     Файл:    inverse_index.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <vector>
+#include "inverse_index.h"
+#include "intervals.h"
+#include "show_values.h"
+#include "list_to_columns.h"
+
+static const char32_t max_char = 0x10FFFF;
+
+using Ranges = std::vector<Segment<char32_t>>;
+
+static std::vector<Ranges> ranges_of_categories(const std::vector<Interval>& intervals,
+                                                size_t                       num_of_categories)
+{
+    auto   result            = std::vector<Ranges>(num_of_categories);
+    size_t num_of_intervals  = intervals.size();
+    for(size_t i = 0; i < num_of_intervals; i++){
+        char32_t lower = intervals[i].lower_bound;
+        if(lower > max_char){
+            break;
+        }
+        char32_t upper = (i + 1 < num_of_intervals) ? intervals[i + 1].lower_bound - 1 : max_char;
+        if(upper > max_char){
+            upper = max_char;
+        }
+        for(size_t k = 0; k < num_of_categories; k++){
+            if(!intervals[i].value.test(k)){
+                continue;
+            }
+            auto& r = result[k];
+            if(!r.empty() && (r.back().upper_bound + 1 == lower)){
+                r.back().upper_bound = upper;
+            }else{
+                r.push_back(Segment<char32_t>(lower, upper));
+            }
+        }
+    }
+    return result;
+}
+
+static std::string show_list(const std::vector<std::string>& elems, size_t num_of_columns){
+    Format f;
+    f.indent                 = 4;
+    f.number_of_columns      = num_of_columns;
+    f.spaces_between_columns = 2;
+    return string_list_to_columns(elems, f);
+}
+
+static const std::string ranges_api = R"~(struct Category_ranges{
+    const Segment<char32_t>* first;
+    const Segment<char32_t>* last;
+
+    const Segment<char32_t>* begin() const {return first;}
+    const Segment<char32_t>* end()   const {return last;}
+    size_t                   size()  const {return last - first;}
+};
+
+/* Sorted disjoint ranges of characters having the category cat. */
+inline Category_ranges ranges_of_category(Category cat){
+    return Category_ranges{category_ranges + category_ranges_offsets[cat],
+                           category_ranges + category_ranges_offsets[cat + 1]};
+}
+)~";
+
+std::string inverse_index(const SegmentsV<char32_t, Multiword_mask>& sorted_segments,
+                          const Multiword_mask&                       default_set,
+                          size_t                                      num_of_categories)
+{
+    auto ranges = ranges_of_categories(segments_to_intervals(sorted_segments, default_set),
+                                       num_of_categories);
+
+    std::vector<std::string> range_elems;
+    std::vector<std::string> offset_elems;
+    std::vector<std::string> count_elems;
+    size_t                   offset = 0;
+    for(const auto& r : ranges){
+        offset_elems.push_back(std::to_string(offset));
+        size_t count = 0;
+        for(const auto& s : r){
+            range_elems.push_back("{" + show_char32(s.lower_bound) + ", " +
+                                  show_char32(s.upper_bound) + "}");
+            count += s.upper_bound - s.lower_bound + 1;
+        }
+        count_elems.push_back(std::to_string(count));
+        offset += r.size();
+    }
+    offset_elems.push_back(std::to_string(offset));
+
+    std::string result = R"~(/*
+ * Inverse index: the ranges of the category k are the elements of category_ranges with
+ * indices from category_ranges_offsets[k] up to category_ranges_offsets[k + 1] - 1.
+*/
+static const Segment<char32_t> category_ranges[] = {
+)~";
+    result += show_list(range_elems, 4) + "\n};\n\n";
+    result += "static const size_t category_ranges_offsets[] = {\n" +
+              show_list(offset_elems, 8) + "\n};\n\n";
+    result += "static const size_t num_of_chars_in_category[] = {\n" +
+              show_list(count_elems, 8) + "\n};\n\n";
+    result += ranges_api;
+    return result;
+}
@@ -0,0 +1,27 @@
+/*
+     Файл:    inverse_index.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef INVERSE_INDEX_H
+#define INVERSE_INDEX_H
+#include <string>
+#include "segment.h"
+#include "multiword_mask.h"
+/**
+ * \param [in] sorted_segments    grouped segments in increasing order
+ * \param [in] default_set        set of categories of characters outside of the segments
+ * \param [in] num_of_categories  number of elements of the enumeration Category
+ *
+ * \return text of the inverse index: for each category, the sorted list of disjoint
+ *         ranges of characters from 0 to U+10FFFF having this category, the number of
+ *         such characters, and the function ranges_of_category returning an iterable
+ *         range of these ranges.
+ */
+std::string inverse_index(const SegmentsV<char32_t, Multiword_mask>& sorted_segments,
+                          const Multiword_mask&                       default_set,
+                          size_t                                      num_of_categories);
+#endif
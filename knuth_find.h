@@ -0,0 +1,38 @@
+/*
+     Файл:    knuth_find.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef KNUTH_FIND_H
+#define KNUTH_FIND_H
+#include <cstddef>
+#include <utility>
+#include "myconcepts.h"
+/* This function uses algorithm from the answer to the exercise 6.2.24 of the monography
+ *  Knuth D.E. The art of computer programming. Volume 3. Sorting and search. --- 2nd ed.
+ *  --- Addison-Wesley, 1998.
+*/
+template<RandomAccessIterator I, typename K>
+std::pair<bool, size_t> knuth_find(I it_begin, I it_end, K key)
+{
+    std::pair<bool, size_t> result = {false, 0};
+    size_t                  i      = 1;
+    size_t                  n      = it_end - it_begin;
+    while (i <= n) {
+        const auto& curr        = it_begin[i - 1];
+        const auto& curr_bounds = curr.bounds;
+        if(key < curr_bounds.lower_bound){
+            i = 2 * i;
+        }else if(key > curr_bounds.upper_bound){
+            i = 2 * i + 1;
+        }else{
+            result.first = true; result.second = i - 1;
+            break;
+        }
+    }
+    return result;
+}
+#endif
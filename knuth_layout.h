@@ -0,0 +1,40 @@
+/*
+     Файл:    knuth_layout.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef KNUTH_LAYOUT_H
+#define KNUTH_LAYOUT_H
+#include <cstddef>
+#include "myconcepts.h"
+#include "segment.h"
+#include "create_permutation.h"
+
+template<RandomAccessIterator DestIt, RandomAccessIterator SrcIt, Callable F>
+void permutate(DestIt dest_begin, SrcIt src_begin, SrcIt src_end, F f){
+    size_t num_of_elems = src_end - src_begin;
+    for(size_t i = 0; i < num_of_elems; ++i){
+        dest_begin[f(i)] = src_begin[i];
+    }
+}
+
+/*
+ * Permutes sorted segments in such way that the array can be searched by knuth_find.
+ * The time of work is proportional to the number of segments.
+*/
+template<Integral K, typename V>
+SegmentsV<K, V> knuth_layout(const SegmentsV<K, V>& sorted_segments){
+    size_t n      = sorted_segments.size();
+    auto   result = SegmentsV<K, V>(n);
+    if(!n){
+        return result;
+    }
+    auto   perm   = create_permutation(n);
+    auto   f      = [&perm](size_t i) -> size_t{return perm[i];};
+    permutate(result.begin(), sorted_segments.begin(), sorted_segments.end(), f);
+    return result;
+}
+#endif
@@ -16,7 +16,7 @@
 template<typename K, typename V>
 std::vector<std::pair<K, V>> map_as_vector(const std::map<K, V>& m){
     std::vector<std::pair<K, V>> result;
-    for(const auto e : m){
+    for(const auto& e : m){
         result.push_back(e);
     }
     return result;
@@ -0,0 +1,51 @@
+/*
+     Файл:    mapped_file.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "mapped_file.h"
+
+Mapped_file::~Mapped_file(){
+    close();
+}
+
+bool Mapped_file::open(const char* name){
+    close();
+    int fd = ::open(name, O_RDONLY);
+    if(fd == -1){
+        return false;
+    }
+    struct stat st;
+    if(fstat(fd, &st) == -1){
+        ::close(fd);
+        return false;
+    }
+    size_t len = static_cast<size_t>(st.st_size);
+    if(len){
+        void* p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(p == MAP_FAILED){
+            ::close(fd);
+            return false;
+        }
+        madvise(p, len, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(p);
+    }
+    size = len;
+    ::close(fd);
+    return true;
+}
+
+void Mapped_file::close(){
+    if(data){
+        munmap(const_cast<char*>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+}
@@ -0,0 +1,32 @@
+/*
+     Файл:    mapped_file.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+#include <cstddef>
+/* Read-only memory mapping of the whole file. */
+class Mapped_file{
+public:
+    Mapped_file()                   = default;
+    Mapped_file(const Mapped_file&) = delete;
+    ~Mapped_file();
+
+    Mapped_file& operator = (const Mapped_file&) = delete;
+
+    /* Returns false and leaves errno set if the file can't be mapped. */
+    bool open(const char* name);
+    void close();
+
+    const char* begin() const {return data;}
+    const char* end()   const {return data + size;}
+    size_t      length() const {return size;}
+private:
+    const char* data = nullptr;
+    size_t      size = 0;
+};
+#endif
@@ -0,0 +1,58 @@
+/*
+     Файл:    multiword_mask.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include "multiword_mask.h"
+
+static const size_t bits_in_word = 64;
+
+void Multiword_mask::set_bit(size_t n){
+    size_t word_idx = n / bits_in_word;
+    if(word_idx >= words.size()){
+        words.resize(word_idx + 1, 0);
+    }
+    words[word_idx] |= 1ULL << (n % bits_in_word);
+}
+
+bool Multiword_mask::test(size_t n) const{
+    return (word(n / bits_in_word) >> (n % bits_in_word)) & 1;
+}
+
+uint64_t Multiword_mask::word(size_t i) const{
+    return (i < words.size()) ? words[i] : 0;
+}
+
+size_t Multiword_mask::num_of_significant_bits() const{
+    if(words.empty()){
+        return 0;
+    }
+    uint64_t highest_word = words.back();
+    size_t   result       = (words.size() - 1) * bits_in_word;
+    while(highest_word){
+        highest_word >>= 1;
+        result++;
+    }
+    return result;
+}
+
+Multiword_mask& Multiword_mask::operator |= (const Multiword_mask& rhs){
+    if(rhs.words.size() > words.size()){
+        words.resize(rhs.words.size(), 0);
+    }
+    for(size_t i = 0; i < rhs.words.size(); i++){
+        words[i] |= rhs.words[i];
+    }
+    return *this;
+}
+
+bool operator == (const Multiword_mask& lhs, const Multiword_mask& rhs){
+    return lhs.words == rhs.words;
+}
+
+bool operator != (const Multiword_mask& lhs, const Multiword_mask& rhs){
+    return !(lhs == rhs);
+}
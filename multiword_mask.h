@@ -0,0 +1,40 @@
+/*
+     Файл:    multiword_mask.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef MULTIWORD_MASK_H
+#define MULTIWORD_MASK_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+/*
+ * Set of categories of arbitrary size. The bit with the number n is stored in the
+ * bit n % 64 of the word n / 64. Trailing zero words are never stored, so two equal
+ * sets always have equal vectors of words.
+*/
+struct Multiword_mask{
+    std::vector<uint64_t> words;
+
+    Multiword_mask()                      = default;
+    Multiword_mask(const Multiword_mask&) = default;
+    ~Multiword_mask()                     = default;
+
+    Multiword_mask& operator = (const Multiword_mask&) = default;
+
+    void   set_bit(size_t n);
+    bool   test(size_t n) const;
+    /* Number of the highest set bit plus one; zero for the empty set. */
+    size_t num_of_significant_bits() const;
+    /* Word with the number i; words beyond the stored ones are zero. */
+    uint64_t word(size_t i) const;
+
+    Multiword_mask& operator |= (const Multiword_mask& rhs);
+};
+
+bool operator == (const Multiword_mask& lhs, const Multiword_mask& rhs);
+bool operator != (const Multiword_mask& lhs, const Multiword_mask& rhs);
+#endif
@@ -0,0 +1,100 @@
+/*
+     Файл:    options.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <cstring>
+#include "options.h"
+
+static const char* search_option = "--search=";
+static const char* table_option  = "--table=";
+static const char* fuse_option   = "--fuse";
+static const char* output_option = "--output=";
+static const char* name_option   = "--output-name=";
+static const char* ns_option     = "--namespace=";
+
+static std::vector<std::string> split_names(const char* p){
+    std::vector<std::string> result;
+    std::string              current;
+    for(; *p; p++){
+        if(*p == ','){
+            result.push_back(current);
+            current.clear();
+        }else{
+            current += *p;
+        }
+    }
+    result.push_back(current);
+    return result;
+}
+
+bool parse_options(int argc, char* argv[], Options& opts){
+    size_t search_option_len = strlen(search_option);
+    size_t table_option_len  = strlen(table_option);
+    size_t fuse_option_len   = strlen(fuse_option);
+    size_t output_option_len = strlen(output_option);
+    size_t name_option_len   = strlen(name_option);
+    size_t ns_option_len     = strlen(ns_option);
+    for(int i = 1; i < argc; i++){
+        const char* arg = argv[i];
+        if(!strncmp(arg, search_option, search_option_len)){
+            const char* kind = arg + search_option_len;
+            if(!strcmp(kind, "table")){
+                opts.search = Search_kind::Table;
+            }else if(!strcmp(kind, "unrolled")){
+                opts.search = Search_kind::Unrolled;
+            }else{
+                return false;
+            }
+        }else if(!strncmp(arg, table_option, table_option_len)){
+            opts.table_name = arg + table_option_len;
+        }else if(!strcmp(arg, fuse_option)){
+            opts.fuse = true;
+            opts.fused_table_names.clear();
+        }else if(!strncmp(arg, fuse_option, fuse_option_len) && (arg[fuse_option_len] == '=')){
+            opts.fuse              = true;
+            opts.fused_table_names = split_names(arg + fuse_option_len + 1);
+        }else if(!strncmp(arg, output_option, output_option_len)){
+            const char* kind = arg + output_option_len;
+            if(!strcmp(kind, "header")){
+                opts.output = Output_kind::Header;
+            }else if(!strcmp(kind, "split")){
+                opts.output = Output_kind::Split;
+            }else if(!strcmp(kind, "templates")){
+                opts.output = Output_kind::Templates;
+            }else{
+                return false;
+            }
+        }else if(!strncmp(arg, name_option, name_option_len) && arg[name_option_len]){
+            opts.output_name = arg + name_option_len;
+        }else if(!strncmp(arg, ns_option, ns_option_len)){
+            opts.name_space = arg + ns_option_len;
+        }else{
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string usage_str(const char* program_name){
+    std::string result = std::string("Usage: ") + program_name + R"~( [options]
+Options:
+    --search=table     search by knuth_find over the table (default)
+    --search=unrolled  search by a tree of comparisons against constants
+    --table=NAME       generate the table NAME instead of the default one; the
+                       table synthetic_N is a synthetic table with N segments
+    --fuse[=NAME,...]  merge the listed tables (by default, all tables) into one
+    --output=header    print the whole table to stdout (default)
+    --output=split     write declarations to NAME.h and arrays to NAME.cpp; NAME.h
+                       includes search_templates.h from the same directory
+    --output=templates write search_templates.h to the directory of NAME; it is
+                       written once for all tables generated by --output=split
+    --output-name=NAME path of the files without extension for --output=split
+                       (default: categories_table)
+    --namespace=NS     put the table into the namespace NS
+)~";
+    return result;
+}
@@ -0,0 +1,45 @@
+/*
+     Файл:    options.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef OPTIONS_H
+#define OPTIONS_H
+#include <string>
+#include <vector>
+
+enum class Search_kind{
+    Table,    //< loop of knuth_find over the table
+    Unrolled  //< balanced tree of comparisons against constants
+};
+
+enum class Output_kind{
+    Header,    //< the whole table as one text to stdout
+    Split,     //< declarations in NAME.h, arrays in NAME.cpp
+    Templates  //< shared header search_templates.h, included by NAME.h
+};
+
+struct Options{
+    Search_kind              search = Search_kind::Table;
+    std::string              table_name;          //< empty for the default table
+    bool                     fuse   = false;      //< whether to merge several tables into one
+    std::vector<std::string> fused_table_names;   //< empty for all tables
+    Output_kind              output = Output_kind::Header;
+    std::string              output_name = "categories_table"; //< NAME for Split and Templates
+    std::string              name_space;          //< empty for the global namespace
+};
+
+/**
+ * \param [in]  argc, argv  command line arguments
+ * \param [out] opts        parsed options
+ *
+ * \return true if all arguments are correct options
+ */
+bool parse_options(int argc, char* argv[], Options& opts);
+
+/* Text of the help about the command line options. */
+std::string usage_str(const char* program_name);
+#endif
@@ -8,12 +8,19 @@
 */
 #ifndef SEGMENT_H
 #define SEGMENT_H
+#include <vector>
+/*
+ * The generated search_templates.h defines the same structs under the same guard, so it
+ * can be included together with this header in any order.
+*/
+#ifndef SEGMENT_STRUCTS_DEFINED
+#define SEGMENT_STRUCTS_DEFINED
 template<typename T>
 struct Segment{
     T lower_bound;
     T upper_bound;
 
-    Segment(T l, T u) : lower_bound(l), upper_bound(u) {};
+    constexpr Segment(T l, T u) : lower_bound(l), upper_bound(u) {};
     Segment()               = default;
     Segment(const Segment&) = default;
     ~Segment()              = default;
@@ -24,11 +31,12 @@ struct Segment_with_value{
     Segment<T> bounds;
     V          value;
 
-    Segment_with_value(Segment<T> b, V v) : bounds(b), value(v) {};
+    constexpr Segment_with_value(Segment<T> b, V v) : bounds(b), value(v) {};
     Segment_with_value()                          = default;
     Segment_with_value(const Segment_with_value&) = default;
     ~Segment_with_value()                         = default;
 };
+#endif
 
 template<typename K, typename V>
 using SegmentsV = std::vector<Segment_with_value<K,V>>;
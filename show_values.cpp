@@ -0,0 +1,60 @@
+/*
+     Файл:    show_values.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <sstream>
+#include <iomanip>
+#include "show_values.h"
+#include "char_conv.h"
+
+std::string show_char32(char32_t c){
+    std::ostringstream oss;
+    bool is_surrogate     = (c >= 0xD800) && (c <= 0xDFFF);
+    bool is_noncharacter  = ((c & 0xFFFE) == 0xFFFE) || ((c >= 0xFDD0) && (c <= 0xFDEF));
+    if((c <= U' ') || ((c >= 0x7F) && (c <= 0x9F)) || is_surrogate || is_noncharacter){
+        oss << std::setw(4) << static_cast<uint32_t>(c);
+    }else if(c == U'\\'){
+        oss << R"~(U'\\')~";
+    }else if(c == U'\''){
+        oss << R"~(U'\'')~";
+    }else{
+        oss << "U'" << char32_to_utf8(c) << "'";
+    }
+    return oss.str();
+}
+
+std::string show_value(const Multiword_mask& m, const Table_types& tt){
+    std::ostringstream oss;
+    if(!tt.is_multiword()){
+        /* The suffix keeps the type of a constant with the highest bit set unsigned. */
+        const char* suffix = (tt.value_type == "uint64_t") ? "ULL" :
+                             (tt.value_type == "uint32_t") ? "U"   : "";
+        oss << "0x" << std::hex << std::uppercase << m.word(0) << suffix;
+        return oss.str();
+    }
+    oss << "{{";
+    for(size_t i = 0; i < tt.num_of_words; i++){
+        if(i){
+            oss << ", ";
+        }
+        oss << "0x" << std::hex << std::setw(16) << std::setfill('0') << m.word(i);
+    }
+    oss << "}}";
+    return oss.str();
+}
+
+std::string show_table_elem(const Segment_with_value<char32_t, Multiword_mask>& e,
+                            const Table_types&                                  tt)
+{
+    std::ostringstream oss;
+    oss << "{{";
+    auto bounds = e.bounds;
+
+    oss << show_char32(bounds.lower_bound) << ", " << show_char32(bounds.upper_bound) << "}, ";
+    oss << std::setw(4) << show_value(e.value, tt) << "}";
+    return oss.str();
+}
@@ -0,0 +1,29 @@
+/*
+     Файл:    show_values.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef SHOW_VALUES_H
+#define SHOW_VALUES_H
+#include <string>
+#include "segment.h"
+#include "multiword_mask.h"
+#include "table_types.h"
+/* Functions building the text of C++ literals for the generated code. */
+
+/*
+ * Character literal for c, or its code if c is a control character, a surrogate or
+ * a noncharacter.
+*/
+std::string show_char32(char32_t c);
+
+/* Literal of the type tt.value_type for the set of categories m. */
+std::string show_value(const Multiword_mask& m, const Table_types& tt);
+
+/* Initializer of an element of the classification table. */
+std::string show_table_elem(const Segment_with_value<char32_t, Multiword_mask>& e,
+                            const Table_types&                                  tt);
+#endif
@@ -0,0 +1,333 @@
+/*
+     Файл:    span_funcs.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "span_funcs.h"
+#include "show_values.h"
+#include "list_to_columns.h"
+
+static const char32_t num_of_direct_chars = 128;
+
+static std::string direct_table(const std::map<char32_t, Multiword_mask>& table,
+                                const Multiword_mask&                     default_set,
+                                const Table_types&                        tt)
+{
+    std::vector<std::string> elems;
+    for(char32_t c = 0; c < num_of_direct_chars; c++){
+        auto it = table.find(c);
+        elems.push_back(show_value((it != table.end()) ? it->second : default_set, tt));
+    }
+
+    Format f;
+    f.indent                 = 4;
+    f.number_of_columns      = tt.is_multiword() ? 1 : 8;
+    f.spaces_between_columns = 1;
+
+    return "static const char32_t num_of_direct_chars = " +
+           std::to_string(num_of_direct_chars) + ";\n\n" +
+           "static const Categories_set direct_categories_table[] = {\n" +
+           string_list_to_columns(elems, f) + "\n};\n\n";
+}
+
+/*
+ * Number of categories that some ASCII character has. Only these categories have rows
+ * in the table direct_category_nibbles.
+*/
+static size_t num_of_ascii_categories(const std::map<char32_t, Multiword_mask>& table,
+                                      const Multiword_mask&                     default_set)
+{
+    size_t result = 0;
+    for(char32_t c = 0; c < num_of_direct_chars; c++){
+        auto it = table.find(c);
+        result  = std::max(result, ((it != table.end()) ? it->second : default_set).num_of_significant_bits());
+    }
+    return result;
+}
+
+/*
+ * Table for the SIMD test of ASCII characters: the row k consists of 16 bytes, and the
+ * bit h of the byte l of the row is set iff the character 16 * h + l has the category k.
+*/
+static std::string nibble_table(const std::map<char32_t, Multiword_mask>& table,
+                                const Multiword_mask&                     default_set)
+{
+    size_t                   num_of_categories = num_of_ascii_categories(table, default_set);
+    std::vector<std::string> elems;
+    /* An empty array isn't allowed, so there is at least one row. */
+    for(size_t k = 0; k < std::max<size_t>(num_of_categories, 1); k++){
+        for(char32_t lo = 0; lo < 16; lo++){
+            unsigned byte = 0;
+            for(char32_t hi = 0; hi < num_of_direct_chars / 16; hi++){
+                auto it = table.find(16 * hi + lo);
+                byte   |= unsigned(((it != table.end()) ? it->second : default_set).test(k)) << hi;
+            }
+            char buf[8];
+            snprintf(buf, sizeof(buf), "0x%X", byte);
+            elems.push_back(buf);
+        }
+    }
+
+    Format f;
+    f.indent                 = 4;
+    f.number_of_columns      = 16;
+    f.spaces_between_columns = 1;
+
+    return "static const size_t num_of_ascii_categories = " + std::to_string(num_of_categories) +
+           ";\n\n"
+           "static const uint8_t direct_category_nibbles[] = {\n" +
+           string_list_to_columns(elems, f) + "\n};\n\n";
+}
+
+static const std::string direct_func_text = R"~(inline Categories_set get_categories_set_direct(char32_t c){
+    return (c < num_of_direct_chars) ? direct_categories_table[c] : get_categories_set(c);
+}
+
+/*
+ * Helpers of the span functions. They are inline rather than static, since the span
+ * functions, which have external linkage, must refer to the same entities in all
+ * translation units.
+*/
+namespace detail{
+)~";
+
+/*
+ * The SSSE3 test of 16 ASCII bytes: the low nibble of each byte selects a byte of the
+ * bitmap by pshufb, and the high nibble selects a bit of this byte.
+*/
+static const std::string ascii_matches_text = R"~(
+/* Bits of the bytes of block that are ASCII characters present in bitmap. */
+inline unsigned ascii_matches(__m128i block, __m128i bitmap){
+    const __m128i bit_of_high = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i low_nibble  = _mm_set1_epi8(0x0F);
+    __m128i       row         = _mm_shuffle_epi8(bitmap, _mm_and_si128(block, low_nibble));
+    __m128i       bit         = _mm_shuffle_epi8(bit_of_high,
+                                                 _mm_and_si128(_mm_srli_epi16(block, 4), low_nibble));
+    __m128i       absent      = _mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128());
+    return ~static_cast<unsigned>(_mm_movemask_epi8(absent)) & 0xFFFF;
+}
+#endif
+
+)~";
+
+static const std::string span_funcs_text = R"~(/*
+ * Decodes one character and moves p past it. Invalid sequences, i.e. overlong forms,
+ * surrogates and values above U+10FFFF, are decoded as U+FFFD one byte at a time.
+*/
+inline char32_t decode_utf8_char(const char*& p, const char* end){
+    static const char32_t min_char_of_len[] = {0, 0, 0x80, 0x800, 0x10000};
+    unsigned char b = static_cast<unsigned char>(*p);
+    size_t        len;
+    char32_t      c;
+    if(b < 0x80){
+        p++;
+        return b;
+    }else if((b >= 0xC2) && (b <= 0xDF)){
+        len = 2; c = b & 0x1F;
+    }else if((b & 0xF0) == 0xE0){
+        len = 3; c = b & 0x0F;
+    }else if((b >= 0xF0) && (b <= 0xF4)){
+        len = 4; c = b & 0x07;
+    }else{
+        p++;
+        return 0xFFFD;
+    }
+    if(static_cast<size_t>(end - p) < len){
+        p++;
+        return 0xFFFD;
+    }
+    for(size_t i = 1; i < len; i++){
+        unsigned char cont = static_cast<unsigned char>(p[i]);
+        if((cont & 0xC0) != 0x80){
+            p++;
+            return 0xFFFD;
+        }
+        c = (c << 6) | (cont & 0x3F);
+    }
+    if((c < min_char_of_len[len]) || ((c >= 0xD800) && (c <= 0xDFFF)) || (c > 0x10FFFF)){
+        p++;
+        return 0xFFFD;
+    }
+    p += len;
+    return c;
+}
+
+/*
+ * Returns the first character from [p, end) for which the presence of categories from
+ * mask differs from expected. While all characters of a block are less than
+ * num_of_direct_chars, blocks of 16 characters are tested by SSSE3 (if it is enabled),
+ * and blocks of four characters are looked up in the direct-indexed table.
+*/
+inline const char32_t* span(const char32_t* p, const char32_t* end,
+                            const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap    = ascii_bitmap(mask);
+    const __m128i  not_ascii = _mm_set1_epi32(~0x7F);
+    const unsigned inverse   = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            const __m128i* v   = reinterpret_cast<const __m128i*>(p);
+            __m128i        a   = _mm_loadu_si128(v);
+            __m128i        b   = _mm_loadu_si128(v + 1);
+            __m128i        c   = _mm_loadu_si128(v + 2);
+            __m128i        d   = _mm_loadu_si128(v + 3);
+            __m128i        any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, not_ascii),
+                                                 _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            __m128i  block = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            unsigned stops = ascii_matches(block, bitmap) ^ inverse;
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 16;
+        }
+#endif
+        while((end - p >= 4) && ((p[0] | p[1] | p[2] | p[3]) < num_of_direct_chars)){
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 4; i++){
+                stops |= unsigned(intersects(direct_categories_table[p[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 4;
+        }
+        if(p == end){
+            return p;
+        }
+        if(intersects(get_categories_set_direct(*p), mask) != expected){
+            return p;
+        }
+        p++;
+    }
+}
+
+/*
+ * The same for UTF-8: blocks of 16 bytes (with SSSE3) and of eight bytes are processed
+ * while all of them are ASCII. The ASCII bytes before the first non-ASCII byte of a block
+ * of 16 bytes are processed by SSSE3 too.
+*/
+inline const char* span_utf8(const char* p, const char* end,
+                             const Categories_set& mask, bool expected)
+{
+#ifdef __SSSE3__
+    const __m128i  bitmap  = ascii_bitmap(mask);
+    const unsigned inverse = expected ? 0xFFFF : 0;
+#endif
+    for(;;){
+#ifdef __SSSE3__
+        while(end - p >= 16){
+            __m128i  block     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned non_ascii = static_cast<unsigned>(_mm_movemask_epi8(block));
+            unsigned stops     = ascii_matches(block, bitmap) ^ inverse;
+            if(non_ascii){
+                stops &= (1u << __builtin_ctz(non_ascii)) - 1;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            if(non_ascii){
+                p += __builtin_ctz(non_ascii);
+                break;
+            }
+            p += 16;
+        }
+#endif
+        while(end - p >= 8){
+            const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+            if((u[0] | u[1] | u[2] | u[3] | u[4] | u[5] | u[6] | u[7]) & 0x80){
+                break;
+            }
+            unsigned stops = 0;
+            for(unsigned i = 0; i < 8; i++){
+                stops |= unsigned(intersects(direct_categories_table[u[i]], mask) != expected) << i;
+            }
+            if(stops){
+                return p + __builtin_ctz(stops);
+            }
+            p += 8;
+        }
+        if(p == end){
+            return p;
+        }
+        const char* q = p;
+        char32_t    c = decode_utf8_char(q, end);
+        if(intersects(get_categories_set_direct(c), mask) != expected){
+            return p;
+        }
+        p = q;
+    }
+}
+} // namespace detail
+
+/* End of the run of characters having at least one category from mask. */
+inline const char32_t* span_while(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, true);
+}
+
+/* End of the run of characters having no categories from mask. */
+inline const char32_t* span_until(const char32_t* p, const char32_t* end,
+                                  const Categories_set& mask)
+{
+    return detail::span(p, end, mask, false);
+}
+
+inline const char* span_while_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, true);
+}
+
+inline const char* span_until_utf8(const char* p, const char* end, const Categories_set& mask){
+    return detail::span_utf8(p, end, mask, false);
+}
+)~";
+
+/* Text of the function that builds the bitmap of pshufb for the categories from a mask. */
+static std::string ascii_bitmap_func(const Table_types& tt){
+    std::string indent(tt.is_multiword() ? 12 : 8, ' ');
+    std::string loop_body = indent + "if(k < num_of_ascii_categories){\n" +
+                            indent + "    const uint8_t* row = direct_category_nibbles + 16 * k;\n" +
+                            indent + "    result = _mm_or_si128(result, "
+                                     "_mm_loadu_si128(reinterpret_cast<const __m128i*>(row)));\n" +
+                            indent + "}\n";
+    std::string loops;
+    if(tt.is_multiword()){
+        loops = R"~(    for(size_t w = 0; w < sizeof(mask.words) / sizeof(mask.words[0]); w++){
+        for(uint64_t m = mask.words[w]; m; m &= m - 1){
+            size_t k = 64 * w + __builtin_ctzll(m);
+)~" + loop_body + "        }\n    }\n";
+    }else{
+        loops = R"~(    for(uint64_t m = mask; m; m &= m - 1){
+        size_t k = __builtin_ctzll(m);
+)~" + loop_body + "    }\n";
+    }
+    return R"~(#ifdef __SSSE3__
+/*
+ * Bitmap of the ASCII characters that have a category from mask: the bit h of the byte l
+ * is set for the character 16 * h + l.
+*/
+inline __m128i ascii_bitmap(const Categories_set& mask){
+    __m128i result = _mm_setzero_si128();
+)~" + loops + "    return result;\n}\n";
+}
+
+std::string span_funcs(const std::map<char32_t, Multiword_mask>& table,
+                       const Multiword_mask&                     default_set,
+                       const Table_types&                        tt)
+{
+    return direct_table(table, default_set, tt) + nibble_table(table, default_set) +
+           direct_func_text + ascii_bitmap_func(tt) + ascii_matches_text + span_funcs_text;
+}
@@ -0,0 +1,30 @@
+/*
+     Файл:    span_funcs.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef SPAN_FUNCS_H
+#define SPAN_FUNCS_H
+#include <map>
+#include <string>
+#include "multiword_mask.h"
+#include "table_types.h"
+/**
+ * \param [in] table        sets of categories of characters
+ * \param [in] default_set  set of categories of characters absent from table
+ * \param [in] tt           types of the generated table
+ *
+ * \return text of the direct-indexed table of sets of categories of ASCII characters
+ *         and of the functions span_while, span_until (for UTF-32) and span_while_utf8,
+ *         span_until_utf8 (for UTF-8). Like strspn and strcspn, these functions return
+ *         the end of the run of characters that have (do not have) a category from the
+ *         mask. ASCII characters are processed in blocks by the direct-indexed table;
+ *         the function get_categories_set is called for other characters only.
+ */
+std::string span_funcs(const std::map<char32_t, Multiword_mask>& table,
+                       const Multiword_mask&                     default_set,
+                       const Table_types&                        tt);
+#endif
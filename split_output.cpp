@@ -0,0 +1,140 @@
+/*
+     Файл:    split_output.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <vector>
+#include <cctype>
+#include "split_output.h"
+
+static const std::string static_const   = "static const ";
+static const std::string array_begin    = "[] = {";
+static const std::string array_end      = "};";
+static const std::string ns_begin       = "namespace ";
+static const std::string ns_end         = "} // namespace ";
+static const std::string func_end       = "}";
+
+/* Beginnings of lines that aren't definitions of functions with external linkage. */
+static const char* not_external_funcs[] = {
+    "inline ", "static ", "template", "struct ", "class ", "enum ", "namespace ", "using ",
+    "extern ", "#", "/", " ", "}"
+};
+
+static bool starts_with(const std::string& s, const std::string& prefix){
+    return !s.compare(0, prefix.size(), prefix);
+}
+
+static bool ends_with(const std::string& s, const std::string& suffix){
+    return (s.size() >= suffix.size()) &&
+           !s.compare(s.size() - suffix.size(), suffix.size(), suffix);
+}
+
+static bool is_external_func_begin(const std::string& line){
+    if(line.empty() || !ends_with(line, "{") || (line.find('(') == std::string::npos)){
+        return false;
+    }
+    for(const char* prefix : not_external_funcs){
+        if(starts_with(line, prefix)){
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<std::string> split_into_lines(const std::string& text){
+    std::vector<std::string> result;
+    size_t                   pos = 0;
+    while(pos < text.size()){
+        size_t end = text.find('\n', pos);
+        if(end == std::string::npos){
+            end = text.size();
+        }
+        result.push_back(text.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    return result;
+}
+
+static std::string include_guard(const std::string& header_name){
+    std::string result;
+    for(char c : header_name){
+        result += isalnum(static_cast<unsigned char>(c)) ?
+                  static_cast<char>(toupper(static_cast<unsigned char>(c))) : '_';
+    }
+    return result;
+}
+
+/* Opens and closes namespaces in the source, so that the namespaces become ns. */
+static void sync_namespaces(std::string&                    source,
+                            std::vector<std::string>&       source_ns,
+                            const std::vector<std::string>& ns)
+{
+    size_t common = 0;
+    while((common < source_ns.size()) && (common < ns.size()) &&
+          (source_ns[common] == ns[common]))
+    {
+        common++;
+    }
+    while(source_ns.size() > common){
+        source += ns_end + source_ns.back() + "\n\n";
+        source_ns.pop_back();
+    }
+    for(size_t i = common; i < ns.size(); i++){
+        source += ns_begin + ns[i] + "{\n";
+        source_ns.push_back(ns[i]);
+    }
+}
+
+Split_output split_output(const std::string& text, const std::string& header_name){
+    Split_output             result;
+    std::string              guard = include_guard(header_name);
+    std::vector<std::string> ns;
+    std::vector<std::string> source_ns;
+    bool                     in_array = false;
+    bool                     in_func  = false;
+
+    result.header = "#ifndef " + guard + "\n#define " + guard + "\n";
+    result.source = "#include \"" + header_name + "\"\n\n";
+    for(const auto& line : split_into_lines(text)){
+        if(in_array){
+            result.source += line + "\n";
+            if(line == array_end){
+                result.source += "\n";
+                in_array       = false;
+            }
+        }else if(in_func){
+            result.source += line + "\n";
+            if(line == func_end){
+                result.source += "\n";
+                in_func        = false;
+            }
+        }else if(is_external_func_begin(line)){
+            result.header += line.substr(0, line.size() - 1) + ";\n";
+            sync_namespaces(result.source, source_ns, ns);
+            result.source += line + "\n";
+            in_func        = true;
+        }else if(starts_with(line, static_const) && ends_with(line, array_begin)){
+            std::string decl = line.substr(static_const.size(),
+                                           line.size() - static_const.size() -
+                                           array_begin.size());
+            result.header += "extern const " + decl + "[];\n";
+            sync_namespaces(result.source, source_ns, ns);
+            result.source += "extern const " + decl + array_begin + "\n";
+            in_array       = true;
+        }else{
+            if(starts_with(line, ns_begin) && ends_with(line, "{")){
+                ns.push_back(line.substr(ns_begin.size(),
+                                         line.size() - ns_begin.size() - 1));
+            }else if(starts_with(line, ns_end) && !ns.empty()){
+                ns.pop_back();
+            }
+            result.header += line + "\n";
+        }
+    }
+    sync_namespaces(result.source, source_ns, std::vector<std::string>());
+    result.header += "#endif\n";
+    return result;
+}
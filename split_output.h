@@ -0,0 +1,35 @@
+/*
+     Файл:    split_output.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef SPLIT_OUTPUT_H
+#define SPLIT_OUTPUT_H
+#include <string>
+/*
+ * Generated table split into a header with declarations and a source with definitions
+ * of arrays. The header doesn't grow with the table, so translation units including it
+ * are compiled in the same time for any table, and only the source is recompiled when
+ * the table changes.
+*/
+struct Split_output{
+    std::string header;
+    std::string source;
+};
+
+/**
+ * \param [in] text         generated text without the search templates; arrays in it are
+ *                          defined as 'static const T name[] = {' ... '};' at the beginning
+ *                          of lines, functions that aren't inline or static are defined as
+ *                          'R f(args){' ... '}' at the beginning of lines, namespaces are
+ *                          opened as 'namespace N{' and closed as '} // namespace N'
+ * \param [in] header_name  name of the header file without directories, e.g. "table.h"
+ *
+ * \return header, where arrays and such functions are replaced by their declarations, and
+ *         source with their definitions in the same namespaces
+ */
+Split_output split_output(const std::string& text, const std::string& header_name);
+#endif
@@ -0,0 +1,142 @@
+/*
+     Файл:    stress-table-handle.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+/*
+ * Stress test of Table_handle: reading threads classify characters while the main thread
+ * publishes new tables. All characters of the table with the version v have the set of
+ * categories v, so a reader checks that
+ *     1) all lookups of a batch in the table obtained by Reader::table() give one value;
+ *     2) the versions returned by Reader::get() never decrease, and never exceed the last
+ *        published version.
+ * The test is built with AddressSanitizer, which reports a use of a reclaimed table.
+ * ThreadSanitizer isn't used, since it can't model atomic_thread_fence in quiescent().
+*/
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "interval_map.h"
+#include "classification_table.h"
+#include "table_handle.h"
+
+using Table  = Classification_table<char32_t, uint64_t>;
+using Handle = Table_handle<char32_t, uint64_t>;
+
+static const size_t   default_num_of_readers = 4;
+static const size_t   default_num_of_swaps   = 20000;
+static const size_t   lookups_in_batch       = 64;
+static const char32_t max_char_in_tables     = 0x3FF;
+
+static const char*    readers_option         = "--readers=";
+static const char*    swaps_option           = "--swaps=";
+
+/* Table with the version v: several segments with the value v, and the default value v. */
+static std::unique_ptr<const Table> create_table(uint64_t v){
+    Interval_map<char32_t, uint64_t> m(v);
+    for(char32_t c = 0; c < max_char_in_tables; c += 0x40){
+        m.insert(Segment<char32_t>(c, c + 0x1F), v);
+    }
+    return std::unique_ptr<const Table>(new Table(m));
+}
+
+struct Reader_result{
+    size_t num_of_batches = 0;
+    size_t num_of_errors  = 0;
+};
+
+static void read_tables(Handle& h, const std::atomic<uint64_t>& last_version,
+                        const std::atomic<bool>& done, Reader_result& result)
+{
+    Handle::Reader r(h);
+    uint64_t       prev_version = 0;
+    char32_t       c            = 0;
+    while(!done.load(std::memory_order_acquire)){
+        const Table* t       = r.table();
+        uint64_t     version = t->get(c);
+        for(size_t i = 0; i < lookups_in_batch; i++){
+            c = (c * 17 + 5) & (2 * max_char_in_tables + 1);
+            if(t->get(c) != version){
+                result.num_of_errors++;
+            }
+        }
+        uint64_t v = r.get(c);
+        if((v < prev_version) || (v < version) ||
+           (v > last_version.load(std::memory_order_acquire)))
+        {
+            result.num_of_errors++;
+        }
+        prev_version = v;
+        r.quiescent();
+        result.num_of_batches++;
+    }
+}
+
+static void usage(const char* program_name){
+    fprintf(stderr,
+            "Usage: %s [--readers=N] [--swaps=M]\n"
+            "By default N is %zu, and M is %zu.\n",
+            program_name, default_num_of_readers, default_num_of_swaps);
+}
+
+int main(int argc, char* argv[]){
+    size_t num_of_readers = default_num_of_readers;
+    size_t num_of_swaps   = default_num_of_swaps;
+    for(int i = 1; i < argc; i++){
+        const char* arg = argv[i];
+        if(!strncmp(arg, readers_option, strlen(readers_option))){
+            num_of_readers = strtoul(arg + strlen(readers_option), nullptr, 10);
+        }else if(!strncmp(arg, swaps_option, strlen(swaps_option))){
+            num_of_swaps = strtoul(arg + strlen(swaps_option), nullptr, 10);
+        }else{
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(!num_of_readers){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::atomic<uint64_t>      last_version{1};
+    std::atomic<bool>          done{false};
+    std::vector<Reader_result> results(num_of_readers);
+    size_t                     not_reclaimed = 0;
+    {
+        Handle                   h(create_table(1));
+        std::vector<std::thread> readers;
+        for(size_t i = 0; i < num_of_readers; i++){
+            readers.emplace_back(read_tables, std::ref(h), std::cref(last_version),
+                                 std::cref(done), std::ref(results[i]));
+        }
+        for(uint64_t v = 2; v < num_of_swaps + 2; v++){
+            /* The version is announced before the table, so readers never see a newer one. */
+            last_version.store(v, std::memory_order_release);
+            h.publish(create_table(v));
+        }
+        done.store(true, std::memory_order_release);
+        for(auto& t : readers){
+            t.join();
+        }
+        not_reclaimed = h.reclaim();
+    }
+
+    size_t num_of_batches = 0;
+    size_t num_of_errors  = 0;
+    for(const auto& r : results){
+        num_of_batches += r.num_of_batches;
+        num_of_errors  += r.num_of_errors;
+    }
+    printf("readers:       %zu\nswaps:         %zu\nbatches:       %zu\n"
+           "errors:        %zu\nnot reclaimed: %zu\n",
+           num_of_readers, num_of_swaps, num_of_batches, num_of_errors, not_reclaimed);
+    return (num_of_errors || not_reclaimed) ? EXIT_FAILURE : 0;
+}
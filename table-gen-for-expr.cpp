@@ -8,12 +8,14 @@
 */
 #include <cstdlib>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <map>
 #include <utility>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include "char_conv.h"
 #include "map_as_vector.h"
 #include "segment.h"
@@ -22,120 +24,49 @@
 #include "permutation_tree_to_permutation.h"
 #include "permutation.h"
 #include "create_permutation.h"
+#include "knuth_layout.h"
 #include "myconcepts.h"
 #include "list_to_columns.h"
-
-enum Category : uint16_t {
-    Spaces,            Other,             Action_name_begin,
-    Action_name_body,  Delimiters,        Dollar,
-    Backslash,         Opened_square_br,  After_colon,
-    After_backslash,   Begin_expr,        End_expr,
-    Hat
-};
-
-static const char32_t* action_name_begin_chars =
-    U"_ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
-static const char32_t* action_name_body_chars =
-    U"_ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
-static const char32_t* delimiters_chars = U"{}()|*+?";
-static const char32_t* after_colon_chars = U"LRbdlnorx";
-static const char32_t* after_backslash_chars = U"^\"(){}[]n$|*+\?\\";
-
-std::map<char32_t, uint16_t> table;
-
-static void insert_char(const char32_t ch, Category category){
-    auto it = table.find(ch);
-    if(it != table.end()){
-        table[ch] |= 1U << category;
-    }else{
-        table[ch] =  1U << category;
-    }
-}
-
-static void add_category(const char32_t* p, Category category){
-    while(char32_t ch = *p++){
-        insert_char(ch, category);
-    }
-}
-
-static std::u32string spaces_str(){
-    std::u32string s;
-    for(char32_t c = 1; c <= U' '; c++){
-        s += c;
-    }
-    return s;
-}
-
-static void fill_table(){
-    std::u32string s = spaces_str();
-
-    add_category(s.c_str(), Spaces);
-    add_category(action_name_begin_chars, Action_name_begin);
-    add_category(action_name_body_chars, Action_name_body);
-    add_category(delimiters_chars, Delimiters);
-    add_category(after_colon_chars, After_colon);
-    add_category(after_backslash_chars, After_backslash);
-    add_category(U"$", Dollar);
-    add_category(U"[", Opened_square_br);
-    add_category(U"\\", Backslash);
-    add_category(U"{", Begin_expr);
-    add_category(U"}", End_expr);
-    add_category(U"^", Hat);
-}
-
-template<RandomAccessIterator DestIt, RandomAccessIterator SrcIt, Callable F>
-void permutate(DestIt dest_begin, SrcIt src_begin, SrcIt src_end, F f){
-    size_t num_of_elems = src_end - src_begin;
-    for(size_t i = 0; i < num_of_elems; ++i){
-        dest_begin[f(i)] = src_begin[i];
-    }
-}
+#include "multiword_mask.h"
+#include "table_types.h"
+#include "show_values.h"
+#include "unrolled_search.h"
+#include "span_funcs.h"
+#include "hint_classifier.h"
+#include "inverse_index.h"
+#include "options.h"
+#include "table_specs.h"
+#include "fused_tables.h"
+#include "split_output.h"
 
 template<Integral K, typename V>
 SegmentsV<K, V> create_classification_table(const std::map<K, V>& m){
    SegmentsV<K,V> grouped_pairs = group_pairs(map_as_vector(m)); // map_as_vector работает нормально, а также и group_pairs
-   size_t         n             = grouped_pairs.size();
-   auto           result        = SegmentsV<K, V>(n);
-   auto           perm          = create_permutation(grouped_pairs.size());
-   auto           f             = [perm](size_t i) -> size_t{return perm[i];};
-   permutate(result.begin(), grouped_pairs.begin(), grouped_pairs.end(), f);
-   return result;
-}
-
-std::string show_char32(char32_t c){
-    std::ostringstream oss;
-    if(c <= U' '){
-        oss << std::setw(4) << static_cast<uint32_t>(c);
-    }else if(c == U'\\'){
-        oss << R"~(U'\\')~";
-    }else{
-        oss << "U'" << char32_to_utf8(c) << "'";
-    }
-    return oss.str();
+   return knuth_layout(grouped_pairs);
 }
 
-std::string show_table_elem(const Segment_with_value<char32_t, uint16_t> e){
-    std::ostringstream oss;
-    oss << "{{";
-    auto     bounds = e.bounds;
-    uint16_t val    = e.value;
-
-    oss << show_char32(bounds.lower_bound) << ", " << show_char32(bounds.upper_bound) << "}, ";
-    oss << std::setw(4) << val << "}";
-    return oss.str();
+static std::string enum_def(const Table_spec& spec){
+    Format f;
+    f.indent                 = 4;
+    f.number_of_columns      = 3;
+    f.spaces_between_columns = 2;
+    std::string columns = string_list_to_columns(spec.category_names, f);
+    std::string result  = "enum Category : uint16_t {\n";
+    /* Columns are padded with spaces, which aren't needed at ends of lines. */
+    size_t      pos     = 0;
+    while(pos < columns.size()){
+        size_t end  = columns.find('\n', pos);
+        if(end == std::string::npos){
+            end = columns.size();
+        }
+        size_t last = columns.find_last_not_of(' ', end - 1);
+        result += columns.substr(pos, last + 1 - pos) + "\n";
+        pos         = end + 1;
+    }
+    return result + "};\n\n";
 }
 
-static const std::string enum_def = R"~(enum Category : uint16_t {
-    Spaces,            Other,             Action_name_begin,
-    Action_name_body,  Delimiters,        Dollar,
-    Backslash,         Opened_square_br,  After_colon,
-    After_backslash,   Begin_expr,        End_expr,
-    Hat
-};
-
-)~";
-
-static const std::string templates = R"~(/*
+static const std::string segment_templates = R"~(/*
  * It happens that in std::map<K,V> the key type is integer, and a lot of keys with the same corresponding values.
  * If such a map must be a generated constant, then this map can be optimized. Namely, iterating through a map using
  * range-based for, we will build a std::vector<std::pair<K, V>>.
@@ -148,11 +79,14 @@ static const std::string templates = R"~(/*
 #define RandomAccessIterator typename
 #define Callable             typename
 #define Integral             typename
+#ifndef SEGMENT_STRUCTS_DEFINED
+#define SEGMENT_STRUCTS_DEFINED
 template<typename T>
 struct Segment{
     T lower_bound;
     T upper_bound;
 
+    constexpr Segment(T l, T u) : lower_bound(l), upper_bound(u) {};
     Segment()               = default;
     Segment(const Segment&) = default;
     ~Segment()              = default;
@@ -163,11 +97,17 @@ struct Segment_with_value{
     Segment<T> bounds;
     V          value;
 
+    constexpr Segment_with_value(Segment<T> b, V v) : bounds(b), value(v) {};
     Segment_with_value()                          = default;
     Segment_with_value(const Segment_with_value&) = default;
     ~Segment_with_value()                         = default;
 };
+#endif
 
+)~";
+
+static const std::string knuth_find_template = R"~(#ifndef KNUTH_FIND_H
+#define KNUTH_FIND_H
 /* This function uses algorithm from the answer to the exercise 6.2.24 of the monography
  *  Knuth D.E. The art of computer programming. Volume 3. Sorting and search. --- 2nd ed.
  *  --- Addison-Wesley, 1998.
@@ -192,10 +132,24 @@ std::pair<bool, size_t> knuth_find(I it_begin, I it_end, K key)
     }
     return result;
 }
+#endif
 )~";
 
-static const std::string categories_table_top =
-    "static const Segment_with_value<char32_t, uint64_t> categories_table[] = {\n";
+static std::string categories_set_def(const Table_types& tt){
+    std::string result;
+    if(tt.is_multiword()){
+        result = "struct Categories_set{\n    uint64_t words[" +
+                 std::to_string(tt.num_of_words) + "];\n};\n\n";
+    }else{
+        result = "using Categories_set = " + tt.value_type + ";\n\n";
+    }
+    return result;
+}
+
+static std::string categories_table_top(const Table_types& tt){
+    return "static const Segment_with_value<" + tt.key_type +
+           ", Categories_set> categories_table[] = {\n";
+}
 
 static std::string size_const(size_t n){
     std::string result;
@@ -204,24 +158,121 @@ static std::string size_const(size_t n){
     return result;
 }
 
-static const std::string get_categories_set_func =
-    R"~(uint64_t get_categories_set(char32_t c){
+static std::string max_char_const(char32_t max_key){
+    return "static const char32_t max_char_in_categories_table = " +
+           show_char32(max_key) + ";\n";
+}
+
+static std::string default_set_const(const Multiword_mask& default_set, const Table_types& tt){
+    return "static const Categories_set default_categories_set = " +
+           show_value(default_set, tt) + ";\n\n";
+}
+
+/*
+ * Characters greater than the maximal upper bound are rejected before the search, and
+ * the key is narrowed to the type of bounds, so that the comparisons in knuth_find are
+ * performed on the narrow type.
+*/
+static std::string get_categories_set_func(const Table_types& tt){
+    std::string result = R"~(inline Categories_set get_categories_set(char32_t c){
+    if(c > max_char_in_categories_table){
+        return default_categories_set;
+    }
     auto t = knuth_find(categories_table,
                         categories_table + num_of_elems_in_categories_table,
-                        c);
+                        static_cast<)~" + tt.key_type + R"~(>(c));
+
+    return t.first ? categories_table[t.second].value : default_categories_set;
+}
+
+)~";
+    return result;
+}
 
-    return t.first ? categories_table[t.second].value : (1ULL << Other)
+static std::string belongs_func(const Table_types& tt){
+    if(tt.is_multiword()){
+        return R"~(inline bool belongs(Category cat, const Categories_set& s){
+    return (s.words[cat >> 6] >> (cat & 63)) & 1;
 }
+
 )~";
+    }
+    return R"~(inline bool belongs(Category cat, Categories_set s){
+    return (s >> cat) & 1;
+}
+
+)~";
+}
+
+static std::string intersects_func(const Table_types& tt){
+    if(tt.is_multiword()){
+        return R"~(inline bool intersects(const Categories_set& a, const Categories_set& b){
+    uint64_t result = 0;
+    for(size_t i = 0; i < sizeof(a.words) / sizeof(a.words[0]); i++){
+        result |= a.words[i] & b.words[i];
+    }
+    return result != 0;
+}
+
+)~";
+    }
+    return R"~(inline bool intersects(Categories_set a, Categories_set b){
+    return (a & b) != 0;
+}
+
+)~";
+}
+
+/* Grouped segments of a table in increasing order, and the types for them. */
+struct Table_layout{
+    SegmentsV<char32_t, Multiword_mask> sorted;
+    char32_t                            max_key;
+    Table_types                         tt;
+};
+
+static Table_layout layout_of(const std::map<char32_t, Multiword_mask>& table,
+                              const Multiword_mask&                     default_set)
+{
+    Table_layout result;
+    result.sorted      = group_pairs(map_as_vector(table));
+    result.max_key     = result.sorted.empty() ? 0 : result.sorted.back().bounds.upper_bound;
+    size_t num_of_bits = default_set.num_of_significant_bits();
+    for(const auto& e : result.sorted){
+        num_of_bits = std::max(num_of_bits, e.value.num_of_significant_bits());
+    }
+    result.tt          = choose_table_types(result.max_key, num_of_bits);
+    return result;
+}
+
+/*
+ * Text of the type Categories_set, of the function get_categories_set, and of the
+ * functions using it. The function belongs is emitted only if the enumeration Category
+ * describes the bits of Categories_set.
+*/
+static std::string show_search(const std::map<char32_t, Multiword_mask>& table,
+                               const Multiword_mask&                     default_set,
+                               const Options&                            opts,
+                               bool                                      with_belongs)
+{
+    Table_layout l         = layout_of(table, default_set);
+    const auto&  tt        = l.tt;
+    std::string  set_funcs = (with_belongs ? belongs_func(tt) : std::string()) + intersects_func(tt);
+
+    if(opts.search == Search_kind::Unrolled){
+        return categories_set_def(tt) +
+               default_set_const(default_set, tt) +
+               unrolled_search_func(l.sorted, default_set, tt,
+                                    opts.output != Output_kind::Split) + set_funcs +
+               span_funcs(table, default_set, tt);
+    }
 
-std::string show_table(){
-    std::string s = enum_def + templates + categories_table_top;
+    auto        t = knuth_layout(l.sorted);
 
-    auto        t = create_classification_table(table);
+    std::string s = categories_set_def(tt) + categories_table_top(tt);
 
     Format      f;
     f.indent                 = 4;
-    f.number_of_columns      = 3;
+    f.number_of_columns      = tt.is_multiword() ? 1 : 3;
     f.spaces_between_columns = 2;
 
     std::vector<std::string> elems;
@@ -229,40 +280,233 @@ std::string show_table(){
     size_t num_of_elems   = t.size();
 
     for(const auto& e : t){
-        elems.push_back(show_table_elem(e));
+        elems.push_back(show_table_elem(e, tt));
     }
 
     s += string_list_to_columns(elems, f) + "\n};\n\n";
-    s += size_const(num_of_elems) + get_categories_set_func;
+    s += size_const(num_of_elems) + max_char_const(l.max_key) +
+         default_set_const(default_set, tt) + get_categories_set_func(tt) + set_funcs +
+         span_funcs(table, default_set, tt) + "\n" + hint_classifier_class(tt);
+    return s;
+}
+
+/* The span functions use SSSE3 for ASCII characters, if it is enabled. */
+static const std::string simd_include = "#ifdef __SSSE3__\n#include <tmmintrin.h>\n#endif\n";
+
+/* Text of the templates Segment, Segment_with_value and knuth_find, used by the table. */
+static std::string search_templates(const Options& opts){
+    if(opts.search == Search_kind::Unrolled){
+        return simd_include + segment_templates;
+    }
+    return simd_include + segment_templates + knuth_find_template + "\n";
+}
+
+/* Shared header with the search templates, for tables in the files NAME.h and NAME.cpp. */
+static std::string search_templates_header(){
+    return "#ifndef SEARCH_TEMPLATES_H\n#define SEARCH_TEMPLATES_H\n"
+           "#include <cstddef>\n#include <cstdint>\n#include <utility>\n" +
+           simd_include + segment_templates + knuth_find_template + "#endif\n";
+}
+
+std::string show_table(const Table_spec& spec, const Options& opts){
+    Multiword_mask default_set = default_set_of(spec);
+    auto           sorted      = group_pairs(map_as_vector(spec.table));
+    return enum_def(spec) + show_search(spec.table, default_set, opts, true) + "\n" +
+           inverse_index(sorted, default_set, spec.category_names.size());
+}
+
+static std::string hex_const(uint64_t x){
+    char buf[32];
+    snprintf(buf, sizeof(buf), "0x%llX", static_cast<unsigned long long>(x));
+    return buf;
+}
+
+/* Text of the namespace with the categories of the table spec from the fused table. */
+static std::string show_fused_table_part(const Table_spec& spec, size_t offset,
+                                         const Table_types& fused_tt, const Options& opts)
+{
+    /* The fused table is in the namespace opts.name_space, which encloses this namespace. */
+    std::string    outer       = "::" + (opts.name_space.empty() ? "" : opts.name_space + "::");
+    size_t         width       = spec.category_names.size();
+    Table_types    tt          = choose_table_types(0, width);
+    uint64_t       mask        = (width == 64) ? ~0ULL : ((1ULL << width) - 1);
+    Multiword_mask default_set = default_set_of(spec);
+    auto           sorted      = group_pairs(map_as_vector(spec.table));
+
+    std::string    field;
+    std::string    to_fused;
+    if(fused_tt.is_multiword()){
+        std::string word = std::to_string(offset / 64);
+        std::string bit  = std::to_string(offset % 64);
+        field    = "(fused.words[" + word + "] >> " + bit + ")";
+        to_fused = "    " + outer + "Categories_set result = {};\n"
+                   "    result.words[" + word + "] = static_cast<uint64_t>(s) << " + bit + ";\n"
+                   "    return result;\n";
+    }else{
+        field    = "(fused >> offset_in_fused_set)";
+        to_fused = "    return static_cast<" + outer + "Categories_set>(static_cast<" + outer +
+                   "Categories_set>(s) << offset_in_fused_set);\n";
+    }
+
+    std::string result = "namespace " + spec.name + "{\n" + enum_def(spec) +
+                         categories_set_def(tt) +
+                         "static const size_t offset_in_fused_set = " + std::to_string(offset) +
+                         ";\n\n";
+    result += R"~(/* Set of categories of this table from the fused set of categories of all tables. */
+inline Categories_set categories_of(const )~" + outer + R"~(Categories_set& fused){
+    return static_cast<Categories_set>()~" + field + " & " + hex_const(mask) + R"~();
+}
+
+/* Fused set containing the categories s of this table, e.g. a mask for span_while. */
+inline )~" + outer + R"~(Categories_set to_fused_set(Categories_set s){
+)~" + to_fused + R"~(}
+
+inline Categories_set get_categories_set(char32_t c){
+    return categories_of()~" + outer + R"~(get_categories_set(c));
+}
+
+)~";
+    result += belongs_func(tt) + inverse_index(sorted, default_set, width) +
+              "} // namespace " + spec.name + "\n";
+    return result;
+}
+
+static std::string fusion_report(const std::vector<Table_spec>& specs, const Fused_tables& fused){
+    std::string result;
+    Table_layout l           = layout_of(fused.table, fused.default_set);
+    size_t       fused_size  = l.sorted.size() * element_size(l.tt);
+    result += " * Fused table: " + std::to_string(l.sorted.size()) + " segments of " +
+              std::to_string(element_size(l.tt)) + " bytes, " + std::to_string(fused_size) +
+              " bytes.\n";
+    size_t       total       = 0;
+    for(const auto& spec : specs){
+        Table_layout sl   = layout_of(spec.table, default_set_of(spec));
+        size_t       size = sl.sorted.size() * element_size(sl.tt);
+        result += " * Separate table " + spec.name + ": " + std::to_string(sl.sorted.size()) +
+                  " segments of " + std::to_string(element_size(sl.tt)) + " bytes, " +
+                  std::to_string(size) + " bytes.\n";
+        total += size;
+    }
+    result += " * Separate tables in total: " + std::to_string(total) + " bytes, " +
+              std::to_string(specs.size()) + " searches per character instead of one.\n";
+    return result;
+}
+
+std::string show_fused_tables(const std::vector<Table_spec>& specs, const Fused_tables& fused,
+                              const Options& opts)
+{
+    std::string report = fusion_report(specs, fused);
+    fputs(report.c_str(), stderr);
+
+    std::string s = "/*\n * Fused tables:";
+    for(const auto& spec : specs){
+        s += " " + spec.name;
+    }
+    s += ". Values of the table are packed sets of categories of all tables;\n"
+         " * the categories of each table are in the namespace with the name of the table.\n"
+         " *\n" + report + "*/\n\n";
+    s += show_search(fused.table, fused.default_set, opts, false);
+
+    Table_types fused_tt = layout_of(fused.table, fused.default_set).tt;
+    size_t      n        = specs.size();
+    for(size_t i = 0; i < n; i++){
+        s += "\n" + show_fused_table_part(specs[i], fused.offsets[i], fused_tt, opts);
+    }
     return s;
 }
 
-void print(){
-    std::string s = show_table();
+void print(const std::string& s){
     printf("%s\n", s.c_str());
 }
 
+static bool has_content(const std::string& file_name, const std::string& s){
+    FILE* fp = fopen(file_name.c_str(), "r");
+    if(!fp){
+        return false;
+    }
+    std::string content;
+    char        buf[4096];
+    size_t      n;
+    while((n = fread(buf, 1, sizeof(buf), fp)) > 0){
+        content.append(buf, n);
+    }
+    fclose(fp);
+    return content == s;
+}
+
+/*
+ * Writes s to a temporary file and renames it to file_name, so that a compiler reading
+ * file_name never sees a partially written file. An unchanged file isn't rewritten, so
+ * that the files depending on it aren't recompiled.
+*/
+static bool write_file(const std::string& file_name, const std::string& s){
+    if(has_content(file_name, s)){
+        return true;
+    }
+    std::string temp_name = file_name + ".tmp";
+    FILE*       fp        = fopen(temp_name.c_str(), "w");
+    if(!fp){
+        fprintf(stderr, "Can't write file %s\n", temp_name.c_str());
+        return false;
+    }
+    bool ok = fputs(s.c_str(), fp) >= 0;
+    ok      = (fclose(fp) == 0) && ok;
+    ok      = ok && !rename(temp_name.c_str(), file_name.c_str());
+    if(!ok){
+        fprintf(stderr, "Can't write file %s\n", file_name.c_str());
+        remove(temp_name.c_str());
+    }
+    return ok;
+}
+
+static std::string directory_of(const std::string& name){
+    size_t slash_pos = name.find_last_of('/');
+    return (slash_pos == std::string::npos) ? "" : name.substr(0, slash_pos + 1);
+}
+
+/*
+ * Prints the text of the table with the search templates, or, for Output_kind::Split,
+ * writes the files NAME.h and NAME.cpp. The header search_templates.h is written
+ * separately, by Output_kind::Templates, so that generation of several tables doesn't
+ * rewrite it while other files including it are compiled.
+*/
+static bool emit(const std::string& body, const Options& opts){
+    const auto& ns   = opts.name_space;
+    std::string text = ns.empty() ? body :
+                       "namespace " + ns + "{\n" + body + "} // namespace " + ns + "\n";
+    if(opts.output == Output_kind::Header){
+        print(search_templates(opts) + text);
+        return true;
+    }
+    const auto&  name        = opts.output_name;
+    std::string  header_name = name.substr(directory_of(name).size()) + ".h";
+    Split_output out         = split_output("#include \"search_templates.h\"\n\n" + text,
+                                            header_name);
+    return write_file(name + ".h", out.header) && write_file(name + ".cpp", out.source);
+}
+
 // #define DEBUG
 #ifdef DEBUG
-void print_filled_table(){
+void print_filled_table(const std::map<char32_t, Multiword_mask>& table){
     for(const auto e : table){
         std::string s = show_char32(e.first);
-        printf("{%s, %d} \n", s.c_str(), e.second);
+        printf("{%s, %llu} \n", s.c_str(), static_cast<unsigned long long>(e.second.word(0)));
     }
     putchar('\n');
 }
 
-void print_vector(const std::vector<std::pair<char32_t, uint16_t>>& v){
+void print_vector(const std::vector<std::pair<char32_t, Multiword_mask>>& v){
     for(const auto e : v){
         std::string s = show_char32(e.first);
-        printf("{%s, %d} \n", s.c_str(), e.second);
+        printf("{%s, %llu} \n", s.c_str(), static_cast<unsigned long long>(e.second.word(0)));
     }
     putchar('\n');
 }
 
-void print_grouped_vector(const SegmentsV<char32_t, uint16_t>& gv){
+void print_grouped_vector(const SegmentsV<char32_t, Multiword_mask>& gv){
+    Table_types tt = choose_table_types(U'\U0010FFFF', 64);
     for(const auto e : gv){
-        auto s = show_table_elem(e);
+        auto s = show_table_elem(e, tt);
         printf("%s \n",s.c_str());
     }
     putchar('\n');
@@ -288,11 +532,85 @@ void print_permutation(const Permutation& p){
 }
 #endif
 
-int main(){
-    fill_table();
+static bool find_spec(const std::vector<Table_spec>& specs, const std::string& name,
+                      Table_spec& spec)
+{
+    for(const auto& e : specs){
+        if(e.name == name){
+            spec = e;
+            return true;
+        }
+    }
+    size_t prefix_len = strlen(synthetic_prefix);
+    if(!name.compare(0, prefix_len, synthetic_prefix) && (name.size() > prefix_len) &&
+       (name.find_first_not_of("0123456789", prefix_len) == std::string::npos))
+    {
+        size_t num_of_segments = strtoul(name.c_str() + prefix_len, nullptr, 10);
+        if(num_of_segments){
+            spec = synthetic_spec(num_of_segments);
+            return true;
+        }
+    }
+    fprintf(stderr, "Unknown table %s\n", name.c_str());
+    return false;
+}
+
+int main(int argc, char* argv[]){
+    Options opts;
+    if(!parse_options(argc, argv, opts)){
+        fputs(usage_str(argv[0]).c_str(), stderr);
+        return EXIT_FAILURE;
+    }
+    if(opts.output == Output_kind::Templates){
+        std::string file_name = directory_of(opts.output_name) + "search_templates.h";
+        return write_file(file_name, search_templates_header()) ? 0 : EXIT_FAILURE;
+    }
+    auto specs = table_specs();
+    for(const auto& spec : specs){
+        std::string error = spec_error(spec);
+        if(!error.empty()){
+            fprintf(stderr, "Incorrect specification: %s.\n", error.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    if(opts.fuse){
+        std::vector<Table_spec> fused_specs;
+        if(opts.fused_table_names.empty()){
+            fused_specs = specs;
+        }
+        const auto& names = opts.fused_table_names;
+        for(auto it = names.begin(); it != names.end(); ++it){
+            if(it->empty()){
+                fputs("Empty name of a table in --fuse=.\n", stderr);
+                return EXIT_FAILURE;
+            }
+            if(std::find(names.begin(), it, *it) != it){
+                fprintf(stderr, "Table %s is listed in --fuse= twice.\n", it->c_str());
+                return EXIT_FAILURE;
+            }
+        }
+        for(const auto& name : names){
+            Table_spec spec;
+            if(!find_spec(specs, name, spec)){
+                return EXIT_FAILURE;
+            }
+            fused_specs.push_back(spec);
+        }
+        Fused_tables fused;
+        if(!fuse_tables(fused_specs, fused)){
+            fputs("Tables with more than 64 categories can't be fused.\n", stderr);
+            return EXIT_FAILURE;
+        }
+        return emit(show_fused_tables(fused_specs, fused, opts), opts) ? 0 : EXIT_FAILURE;
+    }
+    Table_spec spec = specs[0];
+    if(!opts.table_name.empty() && !find_spec(specs, opts.table_name, spec)){
+        return EXIT_FAILURE;
+    }
 #ifdef DEBUG
+    const auto& table = spec.table;
     puts("Table as map:");
-    print_filled_table();
+    print_filled_table(table);
     puts("*******************************************************************");
     auto v  = map_as_vector(table);
     puts("Table as vector:");
@@ -322,9 +640,6 @@ int main(){
     puts("Final classification table is: ");
     print_grouped_vector(t);
     puts("*******************************************************************");
-    print();
-#else
-    print();
 #endif
-    return 0;
+    return emit(show_table(spec, opts), opts) ? 0 : EXIT_FAILURE;
 }
\ No newline at end of file
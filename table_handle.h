@@ -0,0 +1,178 @@
+/*
+     Файл:    table_handle.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef TABLE_HANDLE_H
+#define TABLE_HANDLE_H
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include "classification_table.h"
+/*
+ * Handle of the current classification table, which can be replaced at runtime while
+ * other threads classify characters.
+ *
+ * Tables are published by an atomic exchange of the pointer, so a lookup is one acquire
+ * load of the pointer followed by the search in the immutable table. Replaced tables are
+ * reclaimed by quiescent-state-based reclamation: each reading thread owns a Reader and
+ * from time to time, between lookups, calls Reader::quiescent() to announce that it holds
+ * no pointers to tables. A table replaced in the epoch e is deleted when all online
+ * readers have announced an epoch not less than e. Readers that don't read for a long
+ * time should go offline, so as not to delay reclamation.
+*/
+template<Integral K, typename V>
+class Table_handle{
+public:
+    using Table = Classification_table<K, V>;
+
+    class Reader;
+
+    explicit Table_handle(std::unique_ptr<const Table> initial);
+    Table_handle(const Table_handle&) = delete;
+    /* All readers must be destroyed before the handle. */
+    ~Table_handle();
+
+    Table_handle& operator = (const Table_handle&) = delete;
+
+    /* Makes t the current table; the replaced table is deleted when it is safe. */
+    void publish(std::unique_ptr<const Table> t);
+
+    /* Deletes replaced tables that no reader can use; returns the number of the rest. */
+    size_t reclaim();
+private:
+    static const uint64_t offline_epoch = UINT64_MAX;
+
+    struct Retired_table{
+        const Table* table;
+        uint64_t     epoch;
+    };
+
+    struct alignas(64) Reader_slot{
+        std::atomic<uint64_t> epoch{offline_epoch};
+    };
+
+    std::atomic<const Table*>  current;
+    std::atomic<uint64_t>      global_epoch{1};
+
+    std::mutex                 m; //< protects readers and retired
+    std::vector<Reader_slot*>  readers;
+    std::vector<Retired_table> retired;
+
+    size_t reclaim_locked();
+};
+
+/* Reading side of Table_handle; each Reader must be used by one thread only. */
+template<Integral K, typename V>
+class Table_handle<K, V>::Reader{
+public:
+    explicit Reader(Table_handle& h);
+    Reader(const Reader&) = delete;
+    ~Reader();
+
+    Reader& operator = (const Reader&) = delete;
+
+    /* Set of categories of key by the current table: one acquire load and a search. */
+    V get(K key) const {return handle.current.load(std::memory_order_acquire)->get(key);}
+
+    /* The current table; the pointer is valid until the next quiescent() or offline(). */
+    const Table* table() const {return handle.current.load(std::memory_order_acquire);}
+
+    /* Announces that the thread holds no pointers to tables obtained before the call. */
+    void quiescent();
+
+    /* While the reader is offline, it must not call get() or table(). */
+    void offline();
+    void online();
+private:
+    Table_handle& handle;
+    Reader_slot   slot;
+};
+
+template<Integral K, typename V>
+Table_handle<K, V>::Table_handle(std::unique_ptr<const Table> initial) :
+    current(initial.release())
+{
+}
+
+template<Integral K, typename V>
+Table_handle<K, V>::~Table_handle(){
+    for(const auto& r : retired){
+        delete r.table;
+    }
+    delete current.load(std::memory_order_relaxed);
+}
+
+template<Integral K, typename V>
+void Table_handle<K, V>::publish(std::unique_ptr<const Table> t){
+    std::lock_guard<std::mutex> lock(m);
+    const Table* old   = current.exchange(t.release(), std::memory_order_seq_cst);
+    uint64_t     epoch = global_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+    retired.push_back(Retired_table{old, epoch});
+    reclaim_locked();
+}
+
+template<Integral K, typename V>
+size_t Table_handle<K, V>::reclaim(){
+    std::lock_guard<std::mutex> lock(m);
+    return reclaim_locked();
+}
+
+template<Integral K, typename V>
+size_t Table_handle<K, V>::reclaim_locked(){
+    uint64_t min_epoch = offline_epoch;
+    for(const auto r : readers){
+        min_epoch = std::min(min_epoch, r->epoch.load(std::memory_order_seq_cst));
+    }
+    auto is_safe = [min_epoch](const Retired_table& r){return r.epoch <= min_epoch;};
+    for(const auto& r : retired){
+        if(is_safe(r)){
+            delete r.table;
+        }
+    }
+    retired.erase(std::remove_if(retired.begin(), retired.end(), is_safe), retired.end());
+    return retired.size();
+}
+
+template<Integral K, typename V>
+Table_handle<K, V>::Reader::Reader(Table_handle& h) : handle(h)
+{
+    {
+        std::lock_guard<std::mutex> lock(handle.m);
+        handle.readers.push_back(&slot);
+    }
+    online();
+}
+
+template<Integral K, typename V>
+Table_handle<K, V>::Reader::~Reader(){
+    offline();
+    std::lock_guard<std::mutex> lock(handle.m);
+    auto& r = handle.readers;
+    r.erase(std::remove(r.begin(), r.end(), &slot), r.end());
+}
+
+template<Integral K, typename V>
+void Table_handle<K, V>::Reader::quiescent(){
+    slot.epoch.store(handle.global_epoch.load(std::memory_order_seq_cst),
+                     std::memory_order_seq_cst);
+    /* The following loads of the table must not be reordered before the store above. */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template<Integral K, typename V>
+void Table_handle<K, V>::Reader::offline(){
+    slot.epoch.store(offline_epoch, std::memory_order_release);
+}
+
+template<Integral K, typename V>
+void Table_handle<K, V>::Reader::online(){
+    quiescent();
+}
+#endif
@@ -0,0 +1,178 @@
+/*
+     Файл:    table_specs.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <random>
+#include "table_specs.h"
+
+using Table = std::map<char32_t, Multiword_mask>;
+
+static void insert_char(Table& table, const char32_t ch, size_t category){
+    table[ch].set_bit(category);
+}
+
+static void add_category(Table& table, const char32_t* p, size_t category){
+    while(char32_t ch = *p++){
+        insert_char(table, ch, category);
+    }
+}
+
+static std::u32string spaces_str(){
+    std::u32string s;
+    for(char32_t c = 1; c <= U' '; c++){
+        s += c;
+    }
+    return s;
+}
+
+/*
+ * Categories of each table are listed once, in a macro, from which both the enumeration
+ * used for the numbers of bits and the names of the emitted enumeration are built.
+*/
+#define CATEGORY_ENUMERATOR(name) name,
+#define CATEGORY_NAME(name)       #name,
+
+/* Table for the scanner of regular expressions of Myauka. */
+#define EXPR_CATEGORIES(X)                                       \
+    X(Spaces)           X(Other)            X(Action_name_begin) \
+    X(Action_name_body) X(Delimiters)       X(Dollar)            \
+    X(Backslash)        X(Opened_square_br) X(After_colon)       \
+    X(After_backslash)  X(Begin_expr)       X(End_expr)          \
+    X(Hat)
+
+namespace expr{
+enum Category : uint16_t {
+    EXPR_CATEGORIES(CATEGORY_ENUMERATOR)
+};
+} // namespace expr
+
+static const char32_t* action_name_begin_chars =
+    U"_ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+static const char32_t* action_name_body_chars =
+    U"_ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+static const char32_t* delimiters_chars = U"{}()|*+?";
+static const char32_t* after_colon_chars = U"LRbdlnorx";
+static const char32_t* after_backslash_chars = U"^\"(){}[]n$|*+\?\\";
+
+static Table_spec expr_spec(){
+    using namespace expr;
+    Table_spec spec;
+    spec.name             = "expr";
+    spec.category_names   = {EXPR_CATEGORIES(CATEGORY_NAME)};
+    spec.default_category = Other;
+
+    Table&         table  = spec.table;
+    std::u32string s      = spaces_str();
+
+    add_category(table, s.c_str(), Spaces);
+    add_category(table, action_name_begin_chars, Action_name_begin);
+    add_category(table, action_name_body_chars, Action_name_body);
+    add_category(table, delimiters_chars, Delimiters);
+    add_category(table, after_colon_chars, After_colon);
+    add_category(table, after_backslash_chars, After_backslash);
+    add_category(table, U"$", Dollar);
+    add_category(table, U"[", Opened_square_br);
+    add_category(table, U"\\", Backslash);
+    add_category(table, U"{", Begin_expr);
+    add_category(table, U"}", End_expr);
+    add_category(table, U"^", Hat);
+    return spec;
+}
+
+/* Table for the names of character classes [:name:] in regular expressions. */
+#define CLASS_NAME_CATEGORIES(X) \
+    X(Other) X(Letter) X(Colon) X(Closed_square_br)
+
+namespace class_name{
+enum Category : uint16_t {
+    CLASS_NAME_CATEGORIES(CATEGORY_ENUMERATOR)
+};
+} // namespace class_name
+
+static const char32_t* class_name_letters =
+    U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+static Table_spec class_name_spec(){
+    using namespace class_name;
+    Table_spec spec;
+    spec.name             = "class_name";
+    spec.category_names   = {CLASS_NAME_CATEGORIES(CATEGORY_NAME)};
+    spec.default_category = Other;
+
+    Table& table = spec.table;
+
+    add_category(table, class_name_letters, Letter);
+    add_category(table, U":", Colon);
+    add_category(table, U"]", Closed_square_br);
+    return spec;
+}
+
+std::vector<Table_spec> table_specs(){
+    return {expr_spec(), class_name_spec()};
+}
+
+const char* synthetic_prefix = "synthetic_";
+
+static const size_t synthetic_num_of_categories = 8;
+
+Table_spec synthetic_spec(size_t num_of_segments){
+    Table_spec spec;
+    spec.name             = synthetic_prefix + std::to_string(num_of_segments);
+    spec.default_category = 0;
+    for(size_t k = 0; k < synthetic_num_of_categories; k++){
+        spec.category_names.push_back("C" + std::to_string(k));
+    }
+
+    /*
+     * Segments of 1 to 8 characters, separated by gaps of up to 3 characters. A segment
+     * without a gap has a set distinct from the set of the previous one, so the segments
+     * aren't merged. The sets never equal the default set {C0}.
+    */
+    std::mt19937 gen(static_cast<uint32_t>(num_of_segments));
+    char32_t     c    = U' ';
+    uint64_t     prev = 0;
+    for(size_t i = 0; i < num_of_segments; i++){
+        size_t gap = gen() % 4;
+        size_t len = gen() % 8 + 1;
+        uint64_t set;
+        do{
+            set = gen() % 255 + 1;
+        }while((set == 1) || (!gap && (set == prev)));
+        c += static_cast<char32_t>(gap);
+        for(size_t j = 0; j < len; j++, c++){
+            for(size_t k = 0; k < synthetic_num_of_categories; k++){
+                if((set >> k) & 1){
+                    insert_char(spec.table, c, k);
+                }
+            }
+        }
+        prev = set;
+    }
+    return spec;
+}
+
+std::string spec_error(const Table_spec& spec){
+    size_t num_of_categories = spec.category_names.size();
+    if(spec.table.empty()){
+        return "table " + spec.name + " is empty";
+    }
+    if(spec.default_category >= num_of_categories){
+        return "default category of table " + spec.name + " has no name";
+    }
+    for(const auto& e : spec.table){
+        if(e.second.num_of_significant_bits() > num_of_categories){
+            return "table " + spec.name + " has categories without names";
+        }
+    }
+    return std::string();
+}
+
+Multiword_mask default_set_of(const Table_spec& spec){
+    Multiword_mask result;
+    result.set_bit(spec.default_category);
+    return result;
+}
@@ -0,0 +1,46 @@
+/*
+     Файл:    table_specs.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef TABLE_SPECS_H
+#define TABLE_SPECS_H
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include "multiword_mask.h"
+/* Specification of a classification table: categories and the sets of categories of characters. */
+struct Table_spec{
+    std::string                        name;             //< name of the table, an identifier
+    std::vector<std::string>           category_names;   //< elements of the enumeration Category
+    size_t                             default_category; //< category of characters absent from table
+    std::map<char32_t, Multiword_mask> table;            //< sets of categories of characters
+};
+
+/* Specifications of all tables known to the generator; the first one is the default table. */
+std::vector<Table_spec> table_specs();
+
+/* Prefix of the names of synthetic tables: the table synthetic_N has N segments. */
+extern const char* synthetic_prefix;
+
+/*
+ * Synthetic table with num_of_segments segments of pseudo-random sets of 8 categories, for
+ * the benchmarks of the search on tables of different sizes. The table is the same for
+ * the same number of segments.
+*/
+Table_spec synthetic_spec(size_t num_of_segments);
+
+/* Set of categories of characters absent from spec.table. */
+Multiword_mask default_set_of(const Table_spec& spec);
+
+/*
+ * Returns the description of an error in spec, or the empty string if the spec is correct:
+ * the table isn't empty, and the default category and all categories in the table are
+ * less than the number of category names.
+ */
+std::string spec_error(const Table_spec& spec);
+#endif
@@ -0,0 +1,65 @@
+/*
+     Файл:    table_types.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <algorithm>
+#include "table_types.h"
+
+static const size_t bits_in_word = 64;
+
+static size_t bits_in_key(char32_t max_key){
+    if(max_key <= 0xFF){
+        return 8;
+    }else if(max_key <= 0xFFFF){
+        return 16;
+    }else{
+        return 32;
+    }
+}
+
+static std::string key_type_name(size_t bits){
+    switch(bits){
+        case 8:
+            return "uint8_t";
+        case 16:
+            return "uint16_t";
+        default:
+            return "char32_t";
+    }
+}
+
+Table_types choose_table_types(char32_t max_key, size_t num_of_value_bits){
+    Table_types result;
+    result.bits_in_key = bits_in_key(max_key);
+    result.key_type    = key_type_name(result.bits_in_key);
+    if(num_of_value_bits <= 8){
+        result.value_type    = "uint8_t";
+        result.bits_in_value = 8;
+    }else if(num_of_value_bits <= 16){
+        result.value_type    = "uint16_t";
+        result.bits_in_value = 16;
+    }else if(num_of_value_bits <= 32){
+        result.value_type    = "uint32_t";
+        result.bits_in_value = 32;
+    }else if(num_of_value_bits <= bits_in_word){
+        result.value_type    = "uint64_t";
+        result.bits_in_value = bits_in_word;
+    }else{
+        result.value_type    = "Categories_set";
+        result.num_of_words  = (num_of_value_bits + bits_in_word - 1) / bits_in_word;
+        result.bits_in_value = result.num_of_words * bits_in_word;
+    }
+    return result;
+}
+
+size_t element_size(const Table_types& tt){
+    size_t key_size   = tt.bits_in_key / 8;
+    size_t value_size = tt.bits_in_value / 8;
+    size_t alignment  = std::max(key_size, std::min(value_size, bits_in_word / 8));
+    size_t size       = 2 * key_size + value_size;
+    return (size + alignment - 1) / alignment * alignment;
+}
@@ -0,0 +1,41 @@
+/*
+     Файл:    table_types.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef TABLE_TYPES_H
+#define TABLE_TYPES_H
+#include <cstddef>
+#include <string>
+/*
+ * Names of the types used in the generated classification table. The narrowest
+ * types that fit the actual data are chosen, so that more elements of the table
+ * fit into one cache line.
+*/
+struct Table_types{
+    std::string key_type;          //< type of bounds of segments
+    std::string value_type;        //< type of sets of categories
+    size_t      num_of_words = 1;  //< number of 64-bit words in a multiword set
+    size_t      bits_in_value = 0; //< bits in value_type (64 * num_of_words if multiword)
+    size_t      bits_in_key   = 0; //< bits in key_type
+
+    bool is_multiword() const {return num_of_words > 1;}
+};
+
+/**
+ * \param [in] max_key            maximal upper bound of segments
+ * \param [in] num_of_value_bits  number of significant bits in sets of categories,
+ *                                including the set returned for absent characters
+ *
+ * \return the narrowest key type from uint8_t, uint16_t, char32_t and the narrowest
+ *         value type from uint8_t, uint16_t, uint32_t, uint64_t; if there are more
+ *         than 64 categories, the value is a struct of several uint64_t words
+ */
+Table_types choose_table_types(char32_t max_key, size_t num_of_value_bits);
+
+/* Size in bytes of an element of the table, i.e. of Segment_with_value<key_type, value_type>. */
+size_t element_size(const Table_types& tt);
+#endif
@@ -0,0 +1,49 @@
+/*
+     Файл:    unrolled_search.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <vector>
+#include "unrolled_search.h"
+#include "show_values.h"
+#include "intervals.h"
+
+static void show_comparisons_tree(std::string&                 result,
+                                  const std::vector<Interval>& intervals,
+                                  size_t                       first,
+                                  size_t                       last,
+                                  size_t                       indent,
+                                  const Multiword_mask&        default_set,
+                                  const Table_types&           tt)
+{
+    std::string indent_str = std::string(indent, ' ');
+    if(first == last){
+        const auto& v = intervals[first].value;
+        result += indent_str + "return " +
+                  ((v == default_set) ? std::string("default_categories_set") : show_value(v, tt)) +
+                  ";\n";
+        return;
+    }
+    size_t middle = (first + last + 1) / 2;
+    result += indent_str + "if(c < " + show_char32(intervals[middle].lower_bound) + "){\n";
+    show_comparisons_tree(result, intervals, first, middle - 1, indent + 4, default_set, tt);
+    result += indent_str + "}else{\n";
+    show_comparisons_tree(result, intervals, middle, last, indent + 4, default_set, tt);
+    result += indent_str + "}\n";
+}
+
+std::string unrolled_search_func(const SegmentsV<char32_t, Multiword_mask>& sorted_segments,
+                                 const Multiword_mask&                       default_set,
+                                 const Table_types&                          tt,
+                                 bool                                        is_inline)
+{
+    std::string result    = std::string(is_inline ? "inline " : "") +
+                            "Categories_set get_categories_set(char32_t c){\n";
+    auto        intervals = segments_to_intervals(sorted_segments, default_set);
+    show_comparisons_tree(result, intervals, 0, intervals.size() - 1, 4, default_set, tt);
+    result += "}\n\n";
+    return result;
+}
@@ -0,0 +1,32 @@
+/*
+     Файл:    unrolled_search.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef UNROLLED_SEARCH_H
+#define UNROLLED_SEARCH_H
+#include <string>
+#include "segment.h"
+#include "multiword_mask.h"
+#include "table_types.h"
+/**
+ * \param [in] sorted_segments  grouped segments in increasing order
+ * \param [in] default_set      set of categories of characters outside of the segments
+ * \param [in] tt               types of the generated table
+ * \param [in] is_inline        whether the function is defined as inline, i.e. in a
+ *                              header; otherwise it is defined in a source file
+ *
+ * \return text of the function get_categories_set, which searches for a character by
+ *         a balanced tree of comparisons against immediate constants instead of the
+ *         loop of knuth_find over the table. The segments, together with the gaps
+ *         between them, split all characters into n intervals; the depth of the tree
+ *         of comparisons is ceil(log2(n)).
+ */
+std::string unrolled_search_func(const SegmentsV<char32_t, Multiword_mask>& sorted_segments,
+                                 const Multiword_mask&                       default_set,
+                                 const Table_types&                          tt,
+                                 bool                                        is_inline = true);
+#endif
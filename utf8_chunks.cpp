@@ -0,0 +1,33 @@
+/*
+     Файл:    utf8_chunks.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include "utf8_chunks.h"
+
+static bool is_continuation_byte(char c){
+    return (static_cast<unsigned char>(c) & 0b1100'0000) == 0b1000'0000;
+}
+
+std::vector<Chunk> split_utf8_into_chunks(const char* begin, const char* end,
+                                          size_t chunk_size)
+{
+    std::vector<Chunk> result;
+    if(!chunk_size){
+        chunk_size = 1;
+    }
+    const char* p = begin;
+    while(p != end){
+        const char* q = (static_cast<size_t>(end - p) > chunk_size) ? p + chunk_size : end;
+        /* A character in UTF-8 has at most three continuation bytes. */
+        for(size_t i = 0; (i < 3) && (q != end) && is_continuation_byte(*q); i++){
+            q++;
+        }
+        result.push_back(Chunk{p, q});
+        p = q;
+    }
+    return result;
+}
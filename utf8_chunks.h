@@ -0,0 +1,29 @@
+/*
+     Файл:    utf8_chunks.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef UTF8_CHUNKS_H
+#define UTF8_CHUNKS_H
+#include <cstddef>
+#include <vector>
+
+struct Chunk{
+    const char* begin;
+    const char* end;
+};
+
+/**
+ * \param [in] begin, end  text in the encoding UTF-8
+ * \param [in] chunk_size  approximate size of a chunk in bytes
+ *
+ * \return consecutive chunks covering the text. Each boundary between chunks is moved
+ *         forward to the nearest byte that is not a continuation byte, so no character
+ *         is split between two chunks.
+ */
+std::vector<Chunk> split_utf8_into_chunks(const char* begin, const char* end,
+                                          size_t chunk_size);
+#endif
@@ -0,0 +1,1299 @@
+/*
+     Файл:    verify-tables.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+/*
+ * Differential verifier of the generated tables. For every backend, i.e. for every way
+ * of search emitted by table-gen-for-expr, the sets of categories of all characters from
+ * 0 to U+10FFFF are compared, in parallel, with the maps from table_specs.cpp, from which
+ * the tables are generated. The classifiers with the hint are also checked in a random
+ * order of characters. Then the time of one lookup is measured for every backend, as the
+ * ratio to the time of the reference lookup, i.e. of an index into an array, measured in
+ * the same run, and the ratio is compared with the stored baseline.
+ *
+ * The other emitted functions are checked against the same maps: the functions span_while,
+ * span_until and their UTF-8 variants on all characters, for every category as a mask,
+ * and the inverse index, from which the sets of categories of all characters are rebuilt.
+ * The library functions utf8_to_char32, classify_chunks and run_tasks are checked too.
+ *
+ * Returns EXIT_FAILURE if some check fails, or if the ratio of some backend exceeds its
+ * baseline by more than the tolerance. If the baseline was written on another machine,
+ * the excess is only reported, since the ratios depend on the processor too.
+*/
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cstdarg>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "expr_table.h"
+#include "expr_unrolled.h"
+#include "class_name_table.h"
+#include "class_name_unrolled.h"
+#include "fused_table.h"
+#include "fused_unrolled.h"
+#include "synthetic_table_8.h"
+#include "synthetic_unrolled_8.h"
+#include "synthetic_table_16.h"
+#include "synthetic_unrolled_16.h"
+#include "synthetic_table_32.h"
+#include "synthetic_unrolled_32.h"
+#include "synthetic_table_64.h"
+#include "synthetic_unrolled_64.h"
+#include "synthetic_table_128.h"
+#include "synthetic_unrolled_128.h"
+#include "synthetic_table_256.h"
+#include "synthetic_unrolled_256.h"
+#include "table_specs.h"
+#include "work_stealing_pool.h"
+#include "interval_map.h"
+#include "classification_table.h"
+#include "check_interval_map.h"
+#include "char_conv.h"
+#include "classify_chunks.h"
+
+static const char32_t max_char             = 0x10FFFF;
+static const size_t   num_of_chars         = max_char + 1;
+static const size_t   chars_in_task        = 0x1000;
+static const size_t   max_reported         = 10;
+static const size_t   sample_size          = 1 << 20;
+static const size_t   num_of_repetitions   = 5;
+static const size_t   num_of_ratio_passes  = 11;
+static const size_t   num_of_reference_sets = 0x10000;
+static const double   default_tolerance    = 50.0;
+static const char*    default_baseline     = "verify_baseline.txt";
+static const char*    machine_prefix       = "# machine: ";
+static const size_t   num_of_map_changes   = 20000;
+
+static const char*    threads_option       = "--threads=";
+static const char*    baseline_option      = "--baseline=";
+static const char*    tolerance_option     = "--tolerance=";
+static const char*    update_option        = "--update-baseline";
+static const char*    benchmark_option     = "--benchmark-unrolled";
+static const char*    hint_option          = "--benchmark-hint";
+static const char*    no_timing_option     = "--no-timing";
+
+static uint64_t expr_table_get(char32_t c){
+    return expr_table::get_categories_set(c);
+}
+
+static uint64_t expr_table_direct(char32_t c){
+    return expr_table::get_categories_set_direct(c);
+}
+
+static uint64_t expr_table_hint(char32_t c){
+    static thread_local expr_table::Classifier classifier;
+    return classifier.get_categories_set(c);
+}
+
+static uint64_t expr_unrolled_get(char32_t c){
+    return expr_unrolled::get_categories_set(c);
+}
+
+static uint64_t expr_unrolled_direct(char32_t c){
+    return expr_unrolled::get_categories_set_direct(c);
+}
+
+static uint64_t class_name_table_get(char32_t c){
+    return class_name_table::get_categories_set(c);
+}
+
+static uint64_t class_name_unrolled_get(char32_t c){
+    return class_name_unrolled::get_categories_set(c);
+}
+
+static uint64_t fused_table_expr(char32_t c){
+    return fused_table::expr::get_categories_set(c);
+}
+
+static uint64_t fused_table_class_name(char32_t c){
+    return fused_table::class_name::get_categories_set(c);
+}
+
+static uint64_t fused_unrolled_expr(char32_t c){
+    return fused_unrolled::expr::get_categories_set(c);
+}
+
+static uint64_t fused_unrolled_class_name(char32_t c){
+    return fused_unrolled::class_name::get_categories_set(c);
+}
+
+static uint64_t class_name_table_hint(char32_t c){
+    static thread_local class_name_table::Classifier classifier;
+    return classifier.get_categories_set(c);
+}
+
+static uint64_t fused_table_hint(char32_t c){
+    static thread_local fused_table::Classifier classifier;
+    return classifier.get_categories_set(c);
+}
+
+using Table = Classification_table<char32_t, uint64_t>;
+
+/* Runtime maps built from the specs in main(); rebuilt there before the parallel sweep. */
+static Interval_map<char32_t, uint64_t> expr_map;
+static Interval_map<char32_t, uint64_t> class_name_map;
+static std::unique_ptr<const Table>     expr_classification_table;
+static std::unique_ptr<const Table>     class_name_classification_table;
+
+static uint64_t expr_interval_map(char32_t c){
+    return expr_map.get(c);
+}
+
+static uint64_t class_name_interval_map(char32_t c){
+    return class_name_map.get(c);
+}
+
+static uint64_t expr_classification(char32_t c){
+    return expr_classification_table->get(c);
+}
+
+static uint64_t class_name_classification(char32_t c){
+    return class_name_classification_table->get(c);
+}
+
+static volatile uint64_t sink;
+
+/* Time of one lookup in one pass over the sample, in nanoseconds. */
+template<uint64_t (*get)(char32_t)>
+double ns_of_pass(const std::vector<char32_t>& sample){
+    uint64_t acc = 0;
+    auto     t0  = std::chrono::steady_clock::now();
+    for(char32_t c : sample){
+        acc += get(c);
+    }
+    auto     t1  = std::chrono::steady_clock::now();
+    sink         = acc;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / sample.size();
+}
+
+/* Minimal over several repetitions time of one lookup, in nanoseconds. */
+template<uint64_t (*get)(char32_t)>
+double ns_per_lookup(const std::vector<char32_t>& sample){
+    double best = 0;
+    for(size_t r = 0; r < num_of_repetitions; r++){
+        double ns = ns_of_pass<get>(sample);
+        best      = r ? std::min(best, ns) : ns;
+    }
+    return best;
+}
+
+/*
+ * The reference lookup is an index into an array of the sets of the first characters
+ * (which fits into the cache, as the tables do). Its time changes with the frequency of
+ * the processor and with the load of the machine as the times of the backends do, so
+ * the ratios of times to it are much more stable than the times.
+*/
+static std::vector<uint8_t> reference_sets;
+
+static uint64_t reference_get(char32_t c){
+    return reference_sets[c & (num_of_reference_sets - 1)];
+}
+
+/* Time of one lookup, and its ratio to the time of the reference lookup. */
+struct Lookup_time{
+    double ns;
+    double ratio;
+};
+
+/*
+ * The passes of the backend alternate with the passes of the reference lookup, so that
+ * both are measured in the same conditions; the medians over the passes are taken.
+*/
+static Lookup_time lookup_time(double (*measure)(const std::vector<char32_t>&),
+                               const std::vector<char32_t>& sample)
+{
+    std::vector<double> ns;
+    std::vector<double> ratios;
+    for(size_t r = 0; r < num_of_ratio_passes; r++){
+        double reference_ns = ns_of_pass<reference_get>(sample);
+        double backend_ns   = measure(sample);
+        ns.push_back(backend_ns);
+        ratios.push_back(backend_ns / reference_ns);
+    }
+    auto median = [](std::vector<double>& v){
+        std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+        return v[v.size() / 2];
+    };
+    return Lookup_time{median(ns), median(ratios)};
+}
+
+/* Samples for the measurement of time: see create_sample() and create_runs_sample(). */
+enum class Workload{
+    Mixed, Runs
+};
+
+/*
+ * The expected sets of a backend are the sets of the table spec table_name, or, for the
+ * fused tables, the fused sets of all specs. If random_order is true, the characters are
+ * looked up in the random order from create_random_order() instead of the ascending one,
+ * and the time of lookup isn't measured. The function measure makes one pass over the
+ * sample of the workload.
+*/
+struct Backend{
+    const char* name;
+    const char* table_name;
+    uint64_t  (*get)(char32_t c);
+    double    (*measure)(const std::vector<char32_t>& sample);
+    bool        random_order;
+    Workload    workload = Workload::Mixed;
+};
+
+static const Backend backends[] = {
+    {"expr_table",                 "expr",           expr_table_get,
+     ns_of_pass<expr_table_get>,                      false},
+    {"expr_table_direct",          "expr",           expr_table_direct,
+     ns_of_pass<expr_table_direct>,                   false},
+    {"expr_table_hint",            "expr",           expr_table_hint,
+     ns_of_pass<expr_table_hint>,                     false, Workload::Runs},
+    {"expr_table_hint_random",     "expr",           expr_table_hint,
+     nullptr,                                         true},
+    {"expr_unrolled",              "expr",           expr_unrolled_get,
+     ns_of_pass<expr_unrolled_get>,                   false},
+    {"expr_unrolled_direct",       "expr",           expr_unrolled_direct,
+     ns_of_pass<expr_unrolled_direct>,                false},
+    {"fused_table::expr",          "expr",           fused_table_expr,
+     ns_of_pass<fused_table_expr>,                    false},
+    {"fused_unrolled::expr",       "expr",           fused_unrolled_expr,
+     ns_of_pass<fused_unrolled_expr>,                 false},
+    {"expr_interval_map",          "expr",           expr_interval_map,
+     ns_of_pass<expr_interval_map>,                   false},
+    {"expr_classification",        "expr",           expr_classification,
+     ns_of_pass<expr_classification>,                 false},
+    {"class_name_table",           "class_name",     class_name_table_get,
+     ns_of_pass<class_name_table_get>,                false},
+    {"class_name_table_hint",      "class_name",     class_name_table_hint,
+     ns_of_pass<class_name_table_hint>,               false, Workload::Runs},
+    {"class_name_table_hint_random", "class_name",   class_name_table_hint,
+     nullptr,                                         true},
+    {"class_name_unrolled",        "class_name",     class_name_unrolled_get,
+     ns_of_pass<class_name_unrolled_get>,             false},
+    {"fused_table::class_name",    "class_name",     fused_table_class_name,
+     ns_of_pass<fused_table_class_name>,              false},
+    {"fused_unrolled::class_name", "class_name",     fused_unrolled_class_name,
+     ns_of_pass<fused_unrolled_class_name>,           false},
+    {"class_name_interval_map",    "class_name",     class_name_interval_map,
+     ns_of_pass<class_name_interval_map>,             false},
+    {"class_name_classification",  "class_name",     class_name_classification,
+     ns_of_pass<class_name_classification>,           false},
+    {"fused_table_hint",           "fused_table",    fused_table_hint,
+     ns_of_pass<fused_table_hint>,                    false, Workload::Runs},
+    {"fused_table_hint_random",     "fused_table",    fused_table_hint,
+     nullptr,                                         true},
+};
+
+static const size_t num_of_backends = sizeof(backends) / sizeof(backends[0]);
+
+/* The span functions of one namespace, with the mask converted to its Categories_set. */
+struct Span_backend{
+    const char*     name;
+    const char*     table_name;
+    const char32_t* (*span_while)(const char32_t* p, const char32_t* end, uint64_t mask);
+    const char32_t* (*span_until)(const char32_t* p, const char32_t* end, uint64_t mask);
+    const char*     (*span_while_utf8)(const char* p, const char* end, uint64_t mask);
+    const char*     (*span_until_utf8)(const char* p, const char* end, uint64_t mask);
+};
+
+template<typename Set, const char32_t* (*span)(const char32_t*, const char32_t*, const Set&)>
+const char32_t* span_with_mask(const char32_t* p, const char32_t* end, uint64_t mask){
+    return span(p, end, static_cast<Set>(mask));
+}
+
+template<typename Set, const char* (*span)(const char*, const char*, const Set&)>
+const char* span_utf8_with_mask(const char* p, const char* end, uint64_t mask){
+    return span(p, end, static_cast<Set>(mask));
+}
+
+#define SPAN_BACKEND(NS, TABLE_NAME)                                            \
+    {#NS, TABLE_NAME,                                                           \
+     span_with_mask<NS::Categories_set, NS::span_while>,                        \
+     span_with_mask<NS::Categories_set, NS::span_until>,                        \
+     span_utf8_with_mask<NS::Categories_set, NS::span_while_utf8>,              \
+     span_utf8_with_mask<NS::Categories_set, NS::span_until_utf8>}
+
+static const Span_backend span_backends[] = {
+    SPAN_BACKEND(expr_table,          "expr"),
+    SPAN_BACKEND(expr_unrolled,       "expr"),
+    SPAN_BACKEND(class_name_table,    "class_name"),
+    SPAN_BACKEND(class_name_unrolled, "class_name"),
+    SPAN_BACKEND(fused_table,         "fused_table"),
+    SPAN_BACKEND(fused_unrolled,      "fused_unrolled"),
+};
+
+static const size_t num_of_span_backends = sizeof(span_backends) / sizeof(span_backends[0]);
+
+/* The inverse index of one namespace: the ranges and the number of characters of category k. */
+struct Inverse_backend{
+    const char*                     name;
+    const char*                     table_name;
+    std::vector<Segment<char32_t>> (*ranges)(size_t k);
+    size_t                         (*num_of_chars)(size_t k);
+};
+
+template<typename Category, typename Ranges, Ranges (*ranges_of_category)(Category)>
+std::vector<Segment<char32_t>> ranges_as_vector(size_t k){
+    auto r = ranges_of_category(static_cast<Category>(k));
+    return std::vector<Segment<char32_t>>(r.begin(), r.end());
+}
+
+template<const size_t* num_of_chars_in_category>
+size_t num_of_chars_of(size_t k){
+    return num_of_chars_in_category[k];
+}
+
+#define INVERSE_BACKEND(NS, TABLE_NAME)                                         \
+    {#NS, TABLE_NAME,                                                           \
+     ranges_as_vector<NS::Category, NS::Category_ranges, NS::ranges_of_category>, \
+     num_of_chars_of<NS::num_of_chars_in_category>}
+
+static const Inverse_backend inverse_backends[] = {
+    INVERSE_BACKEND(expr_table,                 "expr"),
+    INVERSE_BACKEND(expr_unrolled,              "expr"),
+    INVERSE_BACKEND(fused_table::expr,          "expr"),
+    INVERSE_BACKEND(fused_unrolled::expr,       "expr"),
+    INVERSE_BACKEND(class_name_table,           "class_name"),
+    INVERSE_BACKEND(class_name_unrolled,        "class_name"),
+    INVERSE_BACKEND(fused_table::class_name,    "class_name"),
+    INVERSE_BACKEND(fused_unrolled::class_name, "class_name"),
+};
+
+static const size_t num_of_inverse_backends = sizeof(inverse_backends) /
+                                              sizeof(inverse_backends[0]);
+
+/*
+ * Invalid UTF-8: overlong forms, a surrogate, a value above U+10FFFF, bytes which can't
+ * start a character, and a truncated sequence. Every byte of them is decoded as U+FFFD.
+*/
+static const char* invalid_utf8[] = {
+    "\xC0\xA0", "\xC1\xBF", "\xE0\x80\xAF", "\xF0\x80\x80\xAF", "\xED\xA0\x80",
+    "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF", "\x80", "\xE2\x82",
+};
+
+struct Mismatch{
+    char32_t c;
+    uint64_t expected;
+    uint64_t result;
+};
+
+/* Sets of categories of all characters by the spec, as one word per character. */
+static std::vector<uint64_t> expected_sets(const Table_spec& spec){
+    std::vector<uint64_t> result(num_of_chars, default_set_of(spec).word(0));
+    for(const auto& e : spec.table){
+        result[e.first] = e.second.word(0);
+    }
+    return result;
+}
+
+/* Runtime map with the same sets of categories as the table generated from the spec. */
+static Interval_map<char32_t, uint64_t> interval_map_of(const Table_spec& spec){
+    Interval_map<char32_t, uint64_t> result(default_set_of(spec).word(0));
+    for(const auto& e : spec.table){
+        result.insert(Segment<char32_t>(e.first, e.first), e.second.word(0));
+    }
+    result.rebuild();
+    return result;
+}
+
+/*
+ * The search by knuth_find over the table and the unrolled search, generated from the
+ * synthetic table with num_of_segments segments.
+*/
+struct Search_benchmark{
+    size_t      num_of_segments;
+    uint64_t  (*table_get)(char32_t c);
+    uint64_t  (*unrolled_get)(char32_t c);
+    double    (*table_measure)(const std::vector<char32_t>& sample);
+    double    (*unrolled_measure)(const std::vector<char32_t>& sample);
+};
+
+template<typename Set, Set (*get)(char32_t)>
+uint64_t as_word(char32_t c){
+    return get(c);
+}
+
+#define SEARCH_BENCHMARK(N)                                                                       \
+    {N,                                                                                           \
+     as_word<synthetic_table_##N::Categories_set, synthetic_table_##N::get_categories_set>,       \
+     as_word<synthetic_unrolled_##N::Categories_set, synthetic_unrolled_##N::get_categories_set>, \
+     ns_per_lookup<as_word<synthetic_table_##N::Categories_set,                                   \
+                           synthetic_table_##N::get_categories_set>>,                             \
+     ns_per_lookup<as_word<synthetic_unrolled_##N::Categories_set,                                \
+                           synthetic_unrolled_##N::get_categories_set>>}
+
+static const Search_benchmark search_benchmarks[] = {
+    SEARCH_BENCHMARK(8),  SEARCH_BENCHMARK(16),  SEARCH_BENCHMARK(32),
+    SEARCH_BENCHMARK(64), SEARCH_BENCHMARK(128), SEARCH_BENCHMARK(256),
+};
+
+/* The search over the table of a synthetic table without and with the hint. */
+struct Hint_benchmark{
+    size_t      num_of_segments;
+    uint64_t  (*hint_get)(char32_t c);
+    double    (*table_measure)(const std::vector<char32_t>& sample);
+    double    (*hint_measure)(const std::vector<char32_t>& sample);
+    double    (*hit_rate)(const std::vector<char32_t>& sample);
+};
+
+template<typename Classifier>
+uint64_t hint_get(char32_t c){
+    static thread_local Classifier classifier;
+    return classifier.get_categories_set(c);
+}
+
+/* Rate of hits of a new classifier over the sample. */
+template<typename Classifier>
+double hit_rate_of(const std::vector<char32_t>& sample){
+    Classifier classifier;
+    uint64_t   acc = 0;
+    for(char32_t c : sample){
+        acc += classifier.get_categories_set(c);
+    }
+    sink = acc;
+    return classifier.hit_rate();
+}
+
+#define HINT_BENCHMARK(N)                                                                         \
+    {N,                                                                                           \
+     hint_get<synthetic_table_##N::Classifier>,                                                   \
+     ns_per_lookup<as_word<synthetic_table_##N::Categories_set,                                   \
+                           synthetic_table_##N::get_categories_set>>,                             \
+     ns_per_lookup<hint_get<synthetic_table_##N::Classifier>>,                                    \
+     hit_rate_of<synthetic_table_##N::Classifier>}
+
+static const Hint_benchmark hint_benchmarks[] = {
+    HINT_BENCHMARK(8),  HINT_BENCHMARK(16),  HINT_BENCHMARK(32),
+    HINT_BENCHMARK(64), HINT_BENCHMARK(128), HINT_BENCHMARK(256),
+};
+
+/* Fused sets of categories of all characters, from the sets of both specs. */
+template<typename Fused_set, typename Expr_set, typename Class_name_set>
+static std::vector<uint64_t> fused_sets(Fused_set (*expr_to_fused)(Expr_set),
+                                        Fused_set (*class_name_to_fused)(Class_name_set),
+                                        const std::vector<uint64_t>& expr_sets,
+                                        const std::vector<uint64_t>& class_name_sets)
+{
+    std::vector<uint64_t> result(num_of_chars);
+    for(size_t c = 0; c < num_of_chars; c++){
+        result[c] = expr_to_fused(static_cast<Expr_set>(expr_sets[c])) |
+                    class_name_to_fused(static_cast<Class_name_set>(class_name_sets[c]));
+    }
+    return result;
+}
+
+/*
+ * Lookups of pseudo-random characters: a half of them is ASCII, a quarter is from the
+ * BMP, and a quarter is from the whole range. The seed is fixed, so the sample is the
+ * same for all runs.
+*/
+static std::vector<char32_t> create_sample(){
+    std::vector<char32_t>                   result(sample_size);
+    std::mt19937                            gen(20261018);
+    std::uniform_int_distribution<char32_t> ascii(0, 0x7F);
+    std::uniform_int_distribution<char32_t> bmp(0, 0xFFFF);
+    std::uniform_int_distribution<char32_t> all(0, max_char);
+    for(size_t i = 0; i < sample_size; i++){
+        switch(i & 3){
+            case 0: case 1:
+                result[i] = ascii(gen);
+                break;
+            case 2:
+                result[i] = bmp(gen);
+                break;
+            default:
+                result[i] = all(gen);
+        }
+    }
+    return result;
+}
+
+/*
+ * Lookups with locality, as in text: runs of 4 to 32 characters, each of which is greater
+ * than the previous one by 0 to 2, like letters of words of one script. The runs begin at
+ * pseudo-random characters from 0 to max_key.
+*/
+static std::vector<char32_t> create_runs_sample(char32_t max_key){
+    std::vector<char32_t>                   result;
+    std::mt19937                            gen(20261020);
+    std::uniform_int_distribution<char32_t> begin(0, max_key);
+    std::uniform_int_distribution<size_t>   len(4, 32);
+    std::uniform_int_distribution<char32_t> step(0, 2);
+    while(result.size() < sample_size){
+        char32_t c = begin(gen);
+        for(size_t n = len(gen); n && (result.size() < sample_size); n--){
+            result.push_back(c);
+            c = std::min<char32_t>(c + step(gen), max_char);
+        }
+    }
+    return result;
+}
+
+/*
+ * Characters for the classifiers with the hint in a random order: a quarter is ASCII, a
+ * quarter are near the previous character, a quarter is from the BMP, and a quarter is
+ * from the whole range, so that the hint, its neighbours and the full search are taken.
+*/
+static std::vector<char32_t> create_random_order(){
+    std::vector<char32_t>                   result(num_of_chars);
+    std::mt19937                            gen(20261019);
+    std::uniform_int_distribution<char32_t> ascii(0, 0x7F);
+    std::uniform_int_distribution<int>      near(-4, 4);
+    std::uniform_int_distribution<char32_t> bmp(0, 0xFFFF);
+    std::uniform_int_distribution<char32_t> all(0, max_char);
+    char32_t                                prev = 0;
+    for(size_t i = 0; i < num_of_chars; i++){
+        switch(gen() & 3){
+            case 0:
+                result[i] = ascii(gen);
+                break;
+            case 1:
+                result[i] = static_cast<char32_t>(std::min<int64_t>(std::max<int64_t>(
+                                static_cast<int64_t>(prev) + near(gen), 0), max_char));
+                break;
+            case 2:
+                result[i] = bmp(gen);
+                break;
+            default:
+                result[i] = all(gen);
+        }
+        prev = result[i];
+    }
+    return result;
+}
+
+/* Errors of a check: their number and the descriptions of the first of them. */
+struct Check_result{
+    size_t                   num_of_errors = 0;
+    std::vector<std::string> messages;
+
+    void add(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    void add(const Check_result& other);
+};
+
+void Check_result::add(const char* format, ...){
+    if(messages.size() < max_reported){
+        char    buf[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        messages.push_back(buf);
+    }
+    num_of_errors++;
+}
+
+void Check_result::add(const Check_result& other){
+    for(const auto& m : other.messages){
+        if(messages.size() < max_reported){
+            messages.push_back(m);
+        }
+    }
+    num_of_errors += other.num_of_errors;
+}
+
+/* Masks for the span functions: every category occurring in the sets, and all of them. */
+static std::vector<uint64_t> masks_of(const std::vector<uint64_t>& sets){
+    uint64_t all = 0;
+    for(uint64_t s : sets){
+        all |= s;
+    }
+    std::vector<uint64_t> result;
+    for(size_t k = 0; k < 64; k++){
+        if((all >> k) & 1){
+            result.push_back(1ULL << k);
+        }
+    }
+    result.push_back(all);
+    return result;
+}
+
+/*
+ * Checks span on the text, whose characters chars start at the offsets, the last offset
+ * being the length of the text. Starting from the character i, span must stop at the first
+ * character j >= i for which the presence of categories from mask differs from expected;
+ * the next call starts after the character j.
+*/
+template<typename C>
+static void check_span(const C* (*span)(const C*, const C*, uint64_t), const char* func_name,
+                       bool expected, const std::vector<C>& text,
+                       const std::vector<size_t>& offsets, const std::vector<char32_t>& chars,
+                       const std::vector<uint64_t>& sets, uint64_t mask, Check_result& result)
+{
+    const C* begin = text.data();
+    const C* end   = begin + text.size();
+    size_t   n     = chars.size();
+    for(size_t i = 0; i < n; ){
+        size_t pos = span(begin + offsets[i], end, mask) - begin;
+        size_t j   = i;
+        while((j < n) && (((sets[chars[j]] & mask) != 0) == expected)){
+            j++;
+        }
+        if(pos < offsets[j]){
+            size_t k = std::upper_bound(offsets.begin() + i, offsets.begin() + j + 1, pos) -
+                       offsets.begin() - 1;
+            result.add("U+%04X: %s with mask 0x%llX stops at it", static_cast<unsigned>(chars[k]),
+                       func_name, static_cast<unsigned long long>(mask));
+            return;
+        }
+        if(pos > offsets[j]){
+            result.add("U+%04X: %s with mask 0x%llX doesn't stop at it",
+                       static_cast<unsigned>(chars[j]), func_name,
+                       static_cast<unsigned long long>(mask));
+            return;
+        }
+        i = j + 1;
+    }
+}
+
+/*
+ * Checks the span functions on the characters from first to last - 1, written one after
+ * another as UTF-32 and, without the surrogates, as UTF-8.
+*/
+static Check_result check_spans(const Span_backend& b, const std::vector<uint64_t>& sets,
+                                const std::vector<uint64_t>& masks, size_t first, size_t last)
+{
+    std::vector<char32_t> text32;
+    std::vector<size_t>   offsets32;
+    std::vector<char>     text8;
+    std::vector<size_t>   offsets8;
+    std::vector<char32_t> chars8;
+    for(size_t c = first; c < last; c++){
+        offsets32.push_back(text32.size());
+        text32.push_back(static_cast<char32_t>(c));
+        if((c >= 0xD800) && (c <= 0xDFFF)){
+            continue;
+        }
+        offsets8.push_back(text8.size());
+        chars8.push_back(static_cast<char32_t>(c));
+        std::string u = char32_to_utf8(static_cast<char32_t>(c));
+        text8.insert(text8.end(), u.begin(), u.end());
+    }
+    offsets32.push_back(text32.size());
+    offsets8.push_back(text8.size());
+
+    Check_result result;
+    for(uint64_t m : masks){
+        check_span(b.span_while, "span_while", true, text32, offsets32, text32, sets, m, result);
+        check_span(b.span_until, "span_until", false, text32, offsets32, text32, sets, m, result);
+        if(!chars8.empty()){
+            check_span(b.span_while_utf8, "span_while_utf8", true, text8, offsets8, chars8,
+                       sets, m, result);
+            check_span(b.span_until_utf8, "span_until_utf8", false, text8, offsets8, chars8,
+                       sets, m, result);
+        }
+    }
+    return result;
+}
+
+/* Every byte of invalid UTF-8 must be taken as U+FFFD by the UTF-8 span functions. */
+static Check_result check_invalid_utf8(const Span_backend& b, const std::vector<uint64_t>& sets,
+                                       const std::vector<uint64_t>& masks)
+{
+    Check_result result;
+    for(const char* s : invalid_utf8){
+        const char* end = s + strlen(s);
+        std::string bytes;
+        for(const char* p = s; p != end; p++){
+            char buf[8];
+            snprintf(buf, sizeof(buf), "%s%02X", bytes.empty() ? "" : " ",
+                     static_cast<unsigned char>(*p));
+            bytes += buf;
+        }
+        for(uint64_t m : masks){
+            bool has = (sets[0xFFFD] & m) != 0;
+            if(b.span_while_utf8(s, end, m) != (has ? end : s)){
+                result.add("%s: span_while_utf8 with mask 0x%llX doesn't take it as U+FFFD",
+                           bytes.c_str(), static_cast<unsigned long long>(m));
+            }
+            if(b.span_until_utf8(s, end, m) != (has ? s : end)){
+                result.add("%s: span_until_utf8 with mask 0x%llX doesn't take it as U+FFFD",
+                           bytes.c_str(), static_cast<unsigned long long>(m));
+            }
+        }
+    }
+    return result;
+}
+
+/*
+ * Checks that the ranges of each category are sorted and disjoint, that their lengths sum
+ * up to num_of_chars_in_category, and that the sets of categories rebuilt from the ranges
+ * are the expected sets.
+*/
+static Check_result check_inverse_index(const Inverse_backend& b, const std::vector<uint64_t>& sets,
+                                        size_t num_of_categories)
+{
+    Check_result          result;
+    std::vector<uint64_t> rebuilt(num_of_chars);
+    for(size_t k = 0; k < num_of_categories; k++){
+        auto   ranges = b.ranges(k);
+        size_t count  = 0;
+        for(size_t i = 0; i < ranges.size(); i++){
+            const auto& r = ranges[i];
+            if((r.lower_bound > r.upper_bound) || (r.upper_bound > max_char) ||
+               (i && (ranges[i - 1].upper_bound >= r.lower_bound)))
+            {
+                result.add("category %zu: range U+%04X..U+%04X is out of order", k,
+                           static_cast<unsigned>(r.lower_bound),
+                           static_cast<unsigned>(r.upper_bound));
+                continue;
+            }
+            for(size_t c = r.lower_bound; c <= r.upper_bound; c++){
+                rebuilt[c] |= 1ULL << k;
+            }
+            count += r.upper_bound - r.lower_bound + 1;
+        }
+        if(count != b.num_of_chars(k)){
+            result.add("category %zu: %zu characters in the ranges, num_of_chars_in_category "
+                       "is %zu", k, count, b.num_of_chars(k));
+        }
+    }
+    for(size_t c = 0; c < num_of_chars; c++){
+        if(rebuilt[c] != sets[c]){
+            result.add("U+%04X: expected %llu, rebuilt %llu", static_cast<unsigned>(c),
+                       static_cast<unsigned long long>(sets[c]),
+                       static_cast<unsigned long long>(rebuilt[c]));
+        }
+    }
+    return result;
+}
+
+/*
+ * Checks utf8_to_char32 from char_conv.h: every character except the surrogates, encoded
+ * by char32_to_utf8 into the number of bytes required by its value, must be decoded back
+ * from all its bytes, and every byte of the invalid sequences must be decoded as U+FFFD.
+*/
+static Check_result check_utf8_decoder(){
+    Check_result result;
+    for(char32_t c = 0; c <= max_char; c++){
+        if((c >= 0xD800) && (c <= 0xDFFF)){
+            continue;
+        }
+        std::string s   = char32_to_utf8(c);
+        size_t      len = (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : 4;
+        const char* p   = s.data();
+        char32_t    d   = utf8_to_char32(p, s.data() + s.size());
+        if((s.size() != len) || (d != c) || (p != s.data() + s.size())){
+            result.add("U+%04X: encoded into %zu bytes, decoded as U+%04X from %zu bytes",
+                       static_cast<unsigned>(c), s.size(), static_cast<unsigned>(d),
+                       static_cast<size_t>(p - s.data()));
+        }
+    }
+    for(size_t i = 0; i < sizeof(invalid_utf8) / sizeof(invalid_utf8[0]); i++){
+        const char* s   = invalid_utf8[i];
+        const char* end = s + strlen(s);
+        for(const char* p = s; p != end; p++){
+            const char* q = p;
+            char32_t    d = utf8_to_char32(q, end);
+            if((d != 0xFFFD) || (q != p + 1)){
+                result.add("byte %zu of invalid sequence %zu: decoded as U+%04X from %zu bytes",
+                           static_cast<size_t>(p - s), i, static_cast<unsigned>(d),
+                           static_cast<size_t>(q - p));
+            }
+        }
+    }
+    return result;
+}
+
+/*
+ * Text in UTF-8 for the check of classify_chunks: pseudo-random characters of one to four
+ * bytes mixed with invalid sequences and with sequences truncated by one to three bytes,
+ * so that the boundaries of chunks fall inside all of them.
+*/
+static std::string create_utf8_text(){
+    static const size_t                     text_size = 1 << 16;
+    std::string                             result;
+    std::mt19937                            gen(20261021);
+    std::uniform_int_distribution<char32_t> ascii(0, 0x7F);
+    std::uniform_int_distribution<char32_t> two_bytes(0x80, 0x7FF);
+    std::uniform_int_distribution<char32_t> three_bytes(0x800, 0xFFFF);
+    std::uniform_int_distribution<char32_t> four_bytes(0x10000, max_char);
+    std::uniform_int_distribution<size_t>   invalid(0, sizeof(invalid_utf8) /
+                                                       sizeof(invalid_utf8[0]) - 1);
+    while(result.size() < text_size){
+        char32_t c;
+        switch(gen() % 6){
+            case 0:
+                c = ascii(gen);
+                break;
+            case 1:
+                c = two_bytes(gen);
+                break;
+            case 2:
+                do{
+                    c = three_bytes(gen);
+                }while((c >= 0xD800) && (c <= 0xDFFF));
+                break;
+            case 3:
+                c = four_bytes(gen);
+                break;
+            case 4:
+                result += invalid_utf8[invalid(gen)];
+                continue;
+            default:
+                {
+                    std::string s = char32_to_utf8(four_bytes(gen));
+                    result       += s.substr(0, 1 + gen() % 3);
+                }
+                continue;
+        }
+        result += char32_to_utf8(c);
+    }
+    return result;
+}
+
+/*
+ * Checks that classify_chunks gives, for all sizes of chunks and numbers of threads, the
+ * same sets of categories and the same counters as the sequential decoding of the text.
+ * Several threads are used even on a machine with one hardware thread.
+*/
+static Check_result check_classify_chunks(size_t num_of_threads){
+    static const size_t chunk_sizes[] = {1, 2, 3, 7, 4096};
+    static const size_t min_threads   = 4;
+
+    std::string           text     = create_utf8_text();
+    const char*           begin    = text.data();
+    const char*           end      = begin + text.size();
+    auto                  classify = [](char32_t c){
+        return expr_table::get_categories_set(c);
+    };
+    std::vector<uint64_t> sets;
+    size_t                counters[max_num_of_categories] = {};
+    for(const char* p = begin; p != end; ){
+        uint64_t set = classify(utf8_to_char32(p, end));
+        sets.push_back(set);
+        for(uint64_t bits = set; bits; bits &= bits - 1){
+            counters[__builtin_ctzll(bits)]++;
+        }
+    }
+
+    Check_result result;
+    for(size_t chunk_size : chunk_sizes){
+        for(size_t threads : {static_cast<size_t>(1), std::max(num_of_threads, min_threads)}){
+            auto chunks = classify_chunks<expr_table::Categories_set>(begin, end, classify,
+                                                                      chunk_size, threads, true);
+            auto total  = aggregate(chunks);
+            std::vector<uint64_t> chunk_sets;
+            for(const auto& c : chunks){
+                chunk_sets.insert(chunk_sets.end(), c.categories.begin(), c.categories.end());
+            }
+            if((total.num_of_chars != sets.size()) || (total.num_of_bytes != text.size())){
+                result.add("chunks of %zu bytes, %zu threads: %zu characters in %zu bytes "
+                           "instead of %zu in %zu", chunk_size, threads, total.num_of_chars,
+                           total.num_of_bytes, sets.size(), text.size());
+            }
+            if(chunk_sets != sets){
+                result.add("chunks of %zu bytes, %zu threads: the sets of categories differ",
+                           chunk_size, threads);
+            }
+            for(size_t k = 0; k < max_num_of_categories; k++){
+                if(total.num_of_chars_in_category[k] != counters[k]){
+                    result.add("chunks of %zu bytes, %zu threads: %zu characters of category "
+                               "%zu instead of %zu", chunk_size, threads,
+                               total.num_of_chars_in_category[k], k, counters[k]);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/* Checks that run_tasks executes every task exactly once, for various numbers of tasks. */
+static Check_result check_run_tasks(size_t num_of_threads){
+    static const size_t nums_of_tasks[] = {0, 1, 2, 7, 1000, 100000};
+
+    Check_result result;
+    for(size_t num_of_tasks : nums_of_tasks){
+        for(size_t threads : {static_cast<size_t>(1), num_of_threads, 2 * num_of_threads + 1}){
+            std::vector<std::atomic<unsigned>> runs(num_of_tasks);
+            run_tasks(num_of_tasks, threads, [&](size_t i){
+                runs[i]++;
+            });
+            for(size_t i = 0; i < num_of_tasks; i++){
+                if(runs[i] != 1){
+                    result.add("%zu tasks, %zu threads: task %zu is run %u times",
+                               num_of_tasks, threads, i, runs[i].load());
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/* Prints the results of the checks of a section and returns true if all of them passed. */
+static bool print_results(const char* title, const std::vector<const char*>& names,
+                          const std::vector<Check_result>& results)
+{
+    bool ok = true;
+    printf("%-28s %10s\n", title, "mismatches");
+    for(size_t i = 0; i < names.size(); i++){
+        printf("%-28s %10zu\n", names[i], results[i].num_of_errors);
+        for(const auto& m : results[i].messages){
+            printf("    %s\n", m.c_str());
+        }
+        ok = ok && !results[i].num_of_errors;
+    }
+    return ok;
+}
+
+/*
+ * Benchmark of the search by knuth_find over the table against the unrolled search on the
+ * synthetic tables of different sizes. The characters of the sample are mostly inside the
+ * table, so that searches take the whole depth of the tree. Both searches are also checked
+ * on all characters. Returns false if some of them gives a wrong set of categories.
+*/
+static bool benchmark_unrolled(){
+    bool ok = true;
+    printf("%10s %14s %14s %14s %10s\n",
+           "segments", "table ns", "unrolled ns", "unrolled/table", "mismatches");
+    for(const auto& b : search_benchmarks){
+        auto   spec       = synthetic_spec(b.num_of_segments);
+        auto   exp        = expected_sets(spec);
+        size_t mismatches = 0;
+        for(size_t c = 0; c < num_of_chars; c++){
+            mismatches += (b.table_get(static_cast<char32_t>(c)) != exp[c]) +
+                          (b.unrolled_get(static_cast<char32_t>(c)) != exp[c]);
+        }
+
+        char32_t                                max_key = spec.table.rbegin()->first;
+        std::vector<char32_t>                   sample(sample_size);
+        std::mt19937                            gen(20261018);
+        std::uniform_int_distribution<char32_t> dist(0, max_key + max_key / 8);
+        for(auto& c : sample){
+            c = dist(gen);
+        }
+        double table_ns    = b.table_measure(sample);
+        double unrolled_ns = b.unrolled_measure(sample);
+        printf("%10zu %14.2f %14.2f %14.2f %10zu\n", b.num_of_segments, table_ns, unrolled_ns,
+               unrolled_ns / table_ns, mismatches);
+        ok = ok && !mismatches;
+    }
+    return ok;
+}
+
+/*
+ * Compares the search over the table without and with the hint on the synthetic tables,
+ * whose segments go beyond ASCII from 32 segments on, for runs of characters and for
+ * pseudo-random characters, and reports the rates of hits of the hint.
+*/
+static bool benchmark_hint(){
+    bool ok = true;
+    printf("%10s %14s %14s %14s %14s %10s\n",
+           "segments", "table ns", "hint ns", "hit rate", "random hits", "mismatches");
+    for(const auto& b : hint_benchmarks){
+        auto   spec       = synthetic_spec(b.num_of_segments);
+        auto   exp        = expected_sets(spec);
+        size_t mismatches = 0;
+        for(size_t c = 0; c < num_of_chars; c++){
+            mismatches += (b.hint_get(static_cast<char32_t>(c)) != exp[c]);
+        }
+
+        char32_t                                max_key = spec.table.rbegin()->first;
+        auto                                    runs    = create_runs_sample(max_key);
+        std::vector<char32_t>                   random(sample_size);
+        std::mt19937                            gen(20261018);
+        std::uniform_int_distribution<char32_t> dist(0, max_key);
+        for(auto& c : random){
+            c = dist(gen);
+        }
+        printf("%10zu %14.2f %14.2f %14.3f %14.3f %10zu\n", b.num_of_segments,
+               b.table_measure(runs), b.hint_measure(runs), b.hit_rate(runs),
+               b.hit_rate(random), mismatches);
+        ok = ok && !mismatches;
+    }
+    return ok;
+}
+
+/* Model of the processor from /proc/cpuinfo, or "unknown". */
+static std::string machine_name(){
+    std::string result = "unknown";
+    FILE*       fp     = fopen("/proc/cpuinfo", "r");
+    if(!fp){
+        return result;
+    }
+    char line[256];
+    while(fgets(line, sizeof(line), fp)){
+        const char* colon = strchr(line, ':');
+        if(!strncmp(line, "model name", strlen("model name")) && colon){
+            result = colon + 1 + strspn(colon + 1, " \t");
+            result.erase(result.find_last_not_of(" \t\n") + 1);
+            break;
+        }
+    }
+    fclose(fp);
+    return result;
+}
+
+/* Ratios of the baseline, and the machine on which they were measured. */
+struct Baseline{
+    std::string                   machine;
+    std::map<std::string, double> ratios;
+};
+
+static Baseline read_baseline(const char* file_name){
+    Baseline result;
+    FILE*    fp = fopen(file_name, "r");
+    if(!fp){
+        return result;
+    }
+    char line[256];
+    char name[128];
+    while(fgets(line, sizeof(line), fp)){
+        double ratio;
+        if(!strncmp(line, machine_prefix, strlen(machine_prefix))){
+            result.machine = line + strlen(machine_prefix);
+            result.machine.erase(result.machine.find_last_not_of(" \t\n") + 1);
+        }else if((line[0] != '#') && (sscanf(line, "%127s %lf", name, &ratio) == 2)){
+            result.ratios[name] = ratio;
+        }
+    }
+    fclose(fp);
+    return result;
+}
+
+static bool write_baseline(const char* file_name, const std::vector<Lookup_time>& times){
+    FILE* fp = fopen(file_name, "w");
+    if(!fp){
+        fprintf(stderr, "Can't write file %s\n", file_name);
+        return false;
+    }
+    fputs("# backend, time of lookup / time of the reference lookup; "
+          "written by verify-tables --update-baseline\n", fp);
+    fprintf(fp, "%s%s\n", machine_prefix, machine_name().c_str());
+    for(size_t b = 0; b < num_of_backends; b++){
+        if(backends[b].measure){
+            fprintf(fp, "%s %.3f\n", backends[b].name, times[b].ratio);
+        }
+    }
+    return fclose(fp) == 0;
+}
+
+static void usage(const char* program_name){
+    fprintf(stderr,
+            "Usage: %s [--threads=N] [--baseline=FILE] [--tolerance=PERCENT] "
+            "[--update-baseline | --no-timing]\n"
+            "       %s --benchmark-unrolled | --benchmark-hint\n"
+            "By default N is the number of hardware threads, FILE is %s, and PERCENT is %.0f.\n"
+            "--update-baseline writes the measured ratios to FILE instead of comparing them.\n"
+            "--no-timing skips the measurement of times, leaving the checks only.\n"
+            "--benchmark-unrolled compares the unrolled search with the search over the table\n"
+            "on synthetic tables of 8 to 256 segments, instead of the verification.\n"
+            "--benchmark-hint compares the search over the table without and with the hint on\n"
+            "the same tables, for runs of neighbouring characters, and prints the hit rates.\n",
+            program_name, program_name, default_baseline, default_tolerance);
+}
+
+int main(int argc, char* argv[]){
+    size_t      num_of_threads  = std::thread::hardware_concurrency();
+    const char* baseline_file   = default_baseline;
+    double      tolerance       = default_tolerance;
+    bool        update_baseline = false;
+    bool        benchmark       = false;
+    bool        benchmark_hints = false;
+    bool        timing          = true;
+    for(int i = 1; i < argc; i++){
+        const char* arg = argv[i];
+        if(!strncmp(arg, threads_option, strlen(threads_option))){
+            num_of_threads = strtoul(arg + strlen(threads_option), nullptr, 10);
+        }else if(!strncmp(arg, baseline_option, strlen(baseline_option))){
+            baseline_file = arg + strlen(baseline_option);
+        }else if(!strncmp(arg, tolerance_option, strlen(tolerance_option))){
+            tolerance = strtod(arg + strlen(tolerance_option), nullptr);
+        }else if(!strcmp(arg, update_option)){
+            update_baseline = true;
+        }else if(!strcmp(arg, benchmark_option)){
+            benchmark = true;
+        }else if(!strcmp(arg, hint_option)){
+            benchmark_hints = true;
+        }else if(!strcmp(arg, no_timing_option)){
+            timing = false;
+        }else{
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(!num_of_threads || (tolerance < 0) || (update_baseline && !timing)){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(benchmark){
+        return benchmark_unrolled() ? 0 : EXIT_FAILURE;
+    }
+    if(benchmark_hints){
+        return benchmark_hint() ? 0 : EXIT_FAILURE;
+    }
+
+    auto specs = table_specs();
+    std::map<std::string, std::vector<uint64_t>> expected;
+    std::map<std::string, size_t>                num_of_categories;
+    for(const auto& spec : specs){
+        expected[spec.name]          = expected_sets(spec);
+        num_of_categories[spec.name] = spec.category_names.size();
+        if(spec.name == "expr"){
+            expr_map = interval_map_of(spec);
+        }else if(spec.name == "class_name"){
+            class_name_map = interval_map_of(spec);
+        }
+    }
+    expected["fused_table"]    = fused_sets(fused_table::expr::to_fused_set,
+                                            fused_table::class_name::to_fused_set,
+                                            expected.at("expr"), expected.at("class_name"));
+    expected["fused_unrolled"] = fused_sets(fused_unrolled::expr::to_fused_set,
+                                            fused_unrolled::class_name::to_fused_set,
+                                            expected.at("expr"), expected.at("class_name"));
+    expr_classification_table.reset(new Table(expr_map));
+    class_name_classification_table.reset(new Table(class_name_map));
+    std::map<std::string, std::vector<uint64_t>> masks;
+    for(const auto& e : expected){
+        masks[e.first] = masks_of(e.second);
+    }
+    auto order = create_random_order();
+
+    /* Keys of uint8_t reach the largest key, keys of uint16_t give longer maps. */
+    size_t map_errors = Interval_map_check<uint8_t>(1).run(num_of_map_changes) +
+                        Interval_map_check<uint16_t>(2).run(num_of_map_changes / 10);
+    printf("Interval_map changes: %zu, errors: %zu\n",
+           num_of_map_changes + num_of_map_changes / 10, map_errors);
+
+    /* Each task checks chars_in_task characters by one backend. */
+    size_t tasks_per_backend = (num_of_chars + chars_in_task - 1) / chars_in_task;
+    size_t num_of_tasks      = tasks_per_backend * num_of_backends;
+    std::vector<std::vector<Mismatch>> mismatches(num_of_tasks);
+    run_tasks(num_of_tasks, num_of_threads, [&](size_t i){
+        const auto& b     = backends[i / tasks_per_backend];
+        const auto& exp   = expected.at(b.table_name);
+        size_t      first = (i % tasks_per_backend) * chars_in_task;
+        size_t      last  = std::min(first + chars_in_task, num_of_chars);
+        for(size_t k = first; k < last; k++){
+            char32_t c      = b.random_order ? order[k] : static_cast<char32_t>(k);
+            uint64_t result = b.get(c);
+            if(result != exp[c]){
+                mismatches[i].push_back(Mismatch{c, exp[c], result});
+            }
+        }
+    });
+
+    /* The span functions are checked by the same blocks of characters. */
+    size_t                    num_of_span_tasks = tasks_per_backend * num_of_span_backends;
+    std::vector<Check_result> span_results(num_of_span_tasks);
+    run_tasks(num_of_span_tasks, num_of_threads, [&](size_t i){
+        const auto& b     = span_backends[i / tasks_per_backend];
+        size_t      first = (i % tasks_per_backend) * chars_in_task;
+        size_t      last  = std::min(first + chars_in_task, num_of_chars);
+        span_results[i]   = check_spans(b, expected.at(b.table_name), masks.at(b.table_name),
+                                        first, last);
+    });
+
+    std::vector<Check_result> inverse_results(num_of_inverse_backends);
+    run_tasks(num_of_inverse_backends, num_of_threads, [&](size_t i){
+        const auto& b      = inverse_backends[i];
+        inverse_results[i] = check_inverse_index(b, expected.at(b.table_name),
+                                                 num_of_categories.at(b.table_name));
+    });
+
+    const auto& expr_sets = expected.at("expr");
+    for(size_t c = 0; c < num_of_reference_sets; c++){
+        reference_sets.push_back(static_cast<uint8_t>(expr_sets[c]));
+    }
+
+    auto                     baseline      = read_baseline(baseline_file);
+    bool                     other_machine = !baseline.machine.empty() &&
+                                             (baseline.machine != machine_name());
+    auto                     sample        = create_sample();
+    /* The runs of characters for the classifiers with the hint lie within their tables. */
+    std::map<std::string, std::vector<char32_t>> runs;
+    char32_t                                     max_key = 0;
+    for(const auto& spec : specs){
+        runs[spec.name] = create_runs_sample(spec.table.rbegin()->first);
+        max_key         = std::max(max_key, spec.table.rbegin()->first);
+    }
+    runs["fused_table"] = create_runs_sample(max_key);
+    std::vector<Lookup_time> times(num_of_backends);
+    bool                     ok            = true;
+    bool                     any_slow      = false;
+    printf("%-28s %10s %10s %10s %10s\n", "backend", "mismatches", "ns/lookup", "ratio",
+           "baseline");
+    for(size_t b = 0; b < num_of_backends; b++){
+        std::vector<Mismatch> m;
+        for(size_t i = b * tasks_per_backend; i < (b + 1) * tasks_per_backend; i++){
+            m.insert(m.end(), mismatches[i].begin(), mismatches[i].end());
+        }
+        const auto& backend = backends[b];
+        auto        it      = baseline.ratios.find(backend.name);
+        bool        slow    = false;
+        printf("%-28s %10zu ", backend.name, m.size());
+        if(!backend.measure || !timing){
+            printf("%10s %10s %10s\n", "-", "-", "-");
+        }else{
+            times[b] = lookup_time(backend.measure, (backend.workload == Workload::Runs) ?
+                                                    runs.at(backend.table_name) : sample);
+            slow     = !update_baseline && (it != baseline.ratios.end()) &&
+                       (times[b].ratio > it->second * (1 + tolerance / 100));
+            any_slow = any_slow || slow;
+            printf("%10.2f %10.3f ", times[b].ns, times[b].ratio);
+            if(it != baseline.ratios.end()){
+                printf("%10.3f%s\n", it->second, slow ? "  SLOWER" : "");
+            }else{
+                printf("%10s\n", "-");
+            }
+        }
+        for(size_t k = 0; k < std::min(m.size(), max_reported); k++){
+            printf("    U+%04X: expected %llu, got %llu\n", static_cast<unsigned>(m[k].c),
+                   static_cast<unsigned long long>(m[k].expected),
+                   static_cast<unsigned long long>(m[k].result));
+        }
+        ok = ok && m.empty() && (!slow || other_machine);
+    }
+    if(any_slow && other_machine){
+        printf("The baseline was written on %s, so the slower backends aren't errors.\n",
+               baseline.machine.c_str());
+    }
+
+    std::vector<const char*>  span_names;
+    std::vector<Check_result> span_totals(num_of_span_backends);
+    for(size_t b = 0; b < num_of_span_backends; b++){
+        const auto& backend = span_backends[b];
+        span_names.push_back(backend.name);
+        span_totals[b].add(check_invalid_utf8(backend, expected.at(backend.table_name),
+                                              masks.at(backend.table_name)));
+        for(size_t i = b * tasks_per_backend; i < (b + 1) * tasks_per_backend; i++){
+            span_totals[b].add(span_results[i]);
+        }
+    }
+    printf("\n");
+    ok = print_results("span functions", span_names, span_totals) && ok;
+
+    std::vector<const char*> inverse_names;
+    for(const auto& backend : inverse_backends){
+        inverse_names.push_back(backend.name);
+    }
+    printf("\n");
+    ok = print_results("inverse index", inverse_names, inverse_results) && ok;
+
+    std::vector<const char*>  library_names   = {"utf8_to_char32", "classify_chunks", "run_tasks"};
+    std::vector<Check_result> library_results = {check_utf8_decoder(),
+                                                 check_classify_chunks(num_of_threads),
+                                                 check_run_tasks(num_of_threads)};
+    printf("\n");
+    ok = print_results("library functions", library_names, library_results) && ok;
+
+    if(update_baseline && !write_baseline(baseline_file, times)){
+        return EXIT_FAILURE;
+    }
+    if(timing && !update_baseline && baseline.ratios.empty()){
+        printf("No baseline in %s; run with %s to create it.\n", baseline_file, update_option);
+    }
+    return (ok && !map_errors) ? 0 : EXIT_FAILURE;
+}
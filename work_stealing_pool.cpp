@@ -0,0 +1,75 @@
+/*
+     Файл:    work_stealing_pool.cpp
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include "work_stealing_pool.h"
+
+struct Tasks_range{
+    std::mutex m;
+    size_t     begin = 0;
+    size_t     end   = 0;
+};
+
+static bool take_first(Tasks_range& r, size_t& task_idx){
+    std::lock_guard<std::mutex> lock(r.m);
+    if(r.begin == r.end){
+        return false;
+    }
+    task_idx = r.begin++;
+    return true;
+}
+
+static bool steal_last(Tasks_range& r, size_t& task_idx){
+    std::lock_guard<std::mutex> lock(r.m);
+    if(r.begin == r.end){
+        return false;
+    }
+    task_idx = --r.end;
+    return true;
+}
+
+void run_tasks(size_t num_of_tasks, size_t num_of_threads,
+               const std::function<void(size_t)>& task)
+{
+    if(!num_of_threads){
+        num_of_threads = 1;
+    }
+    if(num_of_threads > num_of_tasks){
+        num_of_threads = num_of_tasks ? num_of_tasks : 1;
+    }
+    std::unique_ptr<Tasks_range[]> ranges(new Tasks_range[num_of_threads]);
+    for(size_t i = 0; i < num_of_threads; i++){
+        ranges[i].begin = num_of_tasks * i / num_of_threads;
+        ranges[i].end   = num_of_tasks * (i + 1) / num_of_threads;
+    }
+
+    auto worker = [&ranges, num_of_threads, &task](size_t own_idx){
+        size_t task_idx;
+        while(take_first(ranges[own_idx], task_idx)){
+            task(task_idx);
+        }
+        for(size_t k = 1; k < num_of_threads; k++){
+            auto& victim = ranges[(own_idx + k) % num_of_threads];
+            while(steal_last(victim, task_idx)){
+                task(task_idx);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(size_t i = 1; i < num_of_threads; i++){
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for(auto& t : threads){
+        t.join();
+    }
+}
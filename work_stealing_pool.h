@@ -0,0 +1,22 @@
+/*
+     Файл:    work_stealing_pool.h
+     Создано: 18 октября 2026г.
+     Автор:   Гаврилов Владимир Сергеевич
+     E-mails: vladimir.s.gavrilov@gmail.com
+              gavrilov.vladimir.s@mail.ru
+              gavvs1977@yandex.ru
+*/
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+#include <cstddef>
+#include <functional>
+/*
+ * Executes task(i) for all i from 0 to num_of_tasks - 1 on num_of_threads threads
+ * (the calling thread is one of them). Initially the tasks are split between the
+ * threads into contiguous ranges; each thread takes tasks from the beginning of its
+ * own range, and a thread that has exhausted its range steals tasks from the end of
+ * the ranges of the other threads.
+*/
+void run_tasks(size_t num_of_tasks, size_t num_of_threads,
+               const std::function<void(size_t)>& task);
+#endif